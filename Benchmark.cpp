@@ -0,0 +1,218 @@
+/**
+* MakeLazy benchmark: lazy evaluation vs. hand fused loop vs. naive temporaries.
+*
+* usage: Benchmark [maximal size (default 10'000'000)] [repetitions (default 5)]
+*
+* every case evaluates 'd += a + b + c' and reports (median over repetitions):
+* > ns per element.
+* > heap allocations per element.
+* > bytes moved per element (element storage read/written plus heap bytes allocated).
+*
+* output is comma separated, one line per case, so it can be diffed between releases.
+**/
+#include "MakeLazy.h"
+
+#include<vector>
+#include<string>
+#include<chrono>
+#include<cstdint>
+#include<cstdlib>
+#include<cstdio>
+#include<new>
+#include<algorithm>
+#include<atomic>
+
+using Clock = std::conditional_t<std::chrono::high_resolution_clock::is_steady,
+    std::chrono::high_resolution_clock,
+    std::chrono::steady_clock>;
+
+//
+// heap allocation counting (replaces global new/delete, which are implemented on top of malloc/free)
+//
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+namespace {
+    std::atomic<std::size_t> g_allocations{};
+    std::atomic<std::size_t> g_allocated_bytes{};
+}
+
+void* operator new(std::size_t xi_size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_allocated_bytes.fetch_add(xi_size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(xi_size ? xi_size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* xi_ptr) noexcept { std::free(xi_ptr); }
+void operator delete(void* xi_ptr, std::size_t) noexcept { std::free(xi_ptr); }
+
+//
+// element types
+//
+struct Element {
+    std::int32_t m_int{};
+    float m_float{};
+    std::string m_string;
+
+    Element() = default;
+    Element(const std::int32_t i, const float f, const std::string& s) : m_int(i), m_float(f), m_string(s) {}
+    Element(const Element&) = default;
+    Element& operator=(const Element&) = default;
+    Element(Element&&) noexcept = default;
+    Element& operator =(Element&&) noexcept = default;
+
+    Element& operator += (const Element& other) {
+        m_int += other.m_int;
+        m_float += other.m_float;
+        m_string += other.m_string;
+        return *this;
+    }
+
+    friend Element operator + (Element lhs, const Element& other) {
+        lhs += other;
+        return lhs;
+    }
+};
+
+// input values, per element type
+template<typename T> struct Inputs;
+template<> struct Inputs<std::string> {
+    static std::string a() { return "expression "; }
+    static std::string b() { return "template "; }
+    static std::string c() { return "rule!"; }
+    static std::string d() { return "99887766"; }
+    static constexpr const char* name{ "string" };
+};
+template<> struct Inputs<Element> {
+    static Element a() { return Element{ 325, -15.0f, "hi" }; }
+    static Element b() { return Element{ -325, 15.0f, " expression " }; }
+    static Element c() { return Element{ 0, 1.0f, "template" }; }
+    static Element d() { return Element{ 0, 0.0f, "__" }; }
+    static constexpr const char* name{ "Element" };
+};
+template<> struct Inputs<float> {
+    static float a() { return 1.0f; }
+    static float b() { return 2.0f; }
+    static float c() { return 3.0f; }
+    static float d() { return 0.5f; }
+    static constexpr const char* name{ "float" };
+};
+template<> struct Inputs<std::int32_t> {
+    static std::int32_t a() { return 1; }
+    static std::int32_t b() { return -2; }
+    static std::int32_t c() { return 3; }
+    static std::int32_t d() { return 7; }
+    static constexpr const char* name{ "int32_t" };
+};
+
+// prevent the optimizer from discarding a result
+template<typename T> void do_not_optimize(const T& xi_value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(xi_value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &xi_value;
+#endif
+}
+
+/**
+* \brief measure one strategy of 'd += a + b + c'
+*
+* @param {xi_size,        in} amount of elements
+* @param {xi_repetitions, in} amount of measured repetitions (after one warmup)
+* @param {xi_strategy,    in} name of strategy
+* @param {xi_traffic,     in} amount of element storage reads/writes per index (a, b, c, d and temporaries)
+* @param {xi_run,         in} callable evaluating the strategy over (a, b, c, d)
+**/
+template<typename T, typename F>
+void measure(std::size_t xi_size, std::size_t xi_repetitions, const char* xi_strategy, std::size_t xi_traffic, F&& xi_run) {
+    std::vector<T> a(xi_size, Inputs<T>::a()),
+                   b(xi_size, Inputs<T>::b()),
+                   c(xi_size, Inputs<T>::c()),
+                   d;
+
+    std::vector<double> nanoseconds;
+    std::size_t allocations{},
+                allocated_bytes{};
+
+    for (std::size_t r{}; r <= xi_repetitions; ++r) {
+        // reset destination outside of measured region (compound assignment grows heap owning elements)
+        d.assign(xi_size, Inputs<T>::d());
+
+        const std::size_t allocations_start{ g_allocations.load() },
+                          bytes_start{ g_allocated_bytes.load() };
+        const Clock::time_point start{ Clock::now() };
+        xi_run(a, b, c, d);
+        const Clock::time_point end{ Clock::now() };
+        do_not_optimize(d.back());
+
+        // first run is a warmup
+        if (r > 0) {
+            allocations     = g_allocations.load() - allocations_start;
+            allocated_bytes = g_allocated_bytes.load() - bytes_start;
+            nanoseconds.push_back(static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+        }
+    }
+
+    std::sort(nanoseconds.begin(), nanoseconds.end());
+    const double median{ nanoseconds[nanoseconds.size() / 2] },
+                 count{ static_cast<double>(xi_size) };
+    std::printf("%s,%zu,%s,%.3f,%.3f,%.1f\n", Inputs<T>::name, xi_size, xi_strategy,
+                median / count,
+                static_cast<double>(allocations) / count,
+                static_cast<double>(xi_traffic * sizeof(T) * xi_size + allocated_bytes) / count);
+}
+
+// measure all strategies for a given element type and size
+template<typename T> void measure_all(std::size_t xi_size, std::size_t xi_repetitions) {
+    using collection = std::vector<T>;
+
+    // lazy evaluation (reads a, b, c, d and writes d)
+    measure<T>(xi_size, xi_repetitions, "lazy", 5, [](collection& a, collection& b, collection& c, collection& d) {
+        Lazy::Container<collection> lazy_a(a),
+                                    lazy_b(b),
+                                    lazy_c(c),
+                                    lazy_d(d);
+        lazy_d += lazy_a + lazy_b + lazy_c;
+    });
+
+    // hand written fused loop
+    measure<T>(xi_size, xi_repetitions, "fused", 5, [](collection& a, collection& b, collection& c, collection& d) {
+        for (std::size_t i{}; i < d.size(); ++i) {
+            d[i] += a[i] + b[i] + c[i];
+        }
+    });
+
+    // a pass per operation, materializing every temporary (two temporaries written and read back)
+    measure<T>(xi_size, xi_repetitions, "naive", 9, [](collection& a, collection& b, collection& c, collection& d) {
+        collection ab(d.size()),
+                   abc(d.size());
+        for (std::size_t i{}; i < d.size(); ++i) {
+            ab[i] = a[i] + b[i];
+        }
+        for (std::size_t i{}; i < d.size(); ++i) {
+            abc[i] = ab[i] + c[i];
+        }
+        for (std::size_t i{}; i < d.size(); ++i) {
+            d[i] += abc[i];
+        }
+    });
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t max_size{ (argc > 1) ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 10'000'000 },
+                      repetitions{ (argc > 2) ? std::max<std::size_t>(1, std::strtoull(argv[2], nullptr, 10)) : 5 };
+
+    std::printf("type,size,strategy,ns_per_element,allocations_per_element,bytes_per_element\n");
+    for (std::size_t size{ 100 }; size <= max_size; size *= 10) {
+        measure_all<std::string>(size, repetitions);
+        measure_all<Element>(size, repetitions);
+        measure_all<float>(size, repetitions);
+        measure_all<std::int32_t>(size, repetitions);
+    }
+
+    return 0;
+}
@@ -8,98 +8,309 @@
 #include <type_traits>
 #include <utility>
 #include <functional>
+#include <tuple>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <optional>
+#include <iterator>
+#include <deque>
+#include <future>
+#include <memory>
+#include <array>
+#include <string>
+#include <stdexcept>
+#include <unordered_map>
+#if defined(MAKELAZY_INSTRUMENTATION)
+#include <chrono>
+#endif
+#if !defined(MAKELAZY_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define MAKELAZY_STREAM
+#include <immintrin.h>
+#endif
+
+// memory mapped (and file backed) collections are available on POSIX systems, define 'MAKELAZY_DISABLE_MMAP' to exclude them
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(MAKELAZY_DISABLE_MMAP)
+#define MAKELAZY_MMAP
+#include <cerrno>
+#include <system_error>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// offloading to an accelerator is available when compiled with OpenMP (4.5 or later), define 'MAKELAZY_OFFLOAD' to include it
+#if defined(_OPENMP) && defined(MAKELAZY_OFFLOAD)
+#define MAKELAZY_TARGET
+#include <omp.h>
+#endif
 
 namespace Lazy {
 
+    // forward declaration
+    template<typename COLLECTION> struct Container;
+    template<typename COLLECTION, typename CondExpr> class Masked;
+    template<typename T, auto... MEMBERS> class Soa;
+    template<typename T> class Sparse;
+    template<typename T> class Rle;
+    template<typename COLLECTION> class Tracked;
+    namespace detail { struct Fusion; }
+
     /**
     * objects to decode lazy operations
     **/
     namespace detail {
 
         /**
-        * \brief a binary expression
+        * packets of elements evaluated together using the widest SIMD register enabled at compile time.
         *
-        * @param {LeftExpr,  in} left side of expression
-        * @param {BinaryOp,  in} binary operation
-        * @param {RightExpr, in} right side of expression
+        * \remarks packet operations are written as fixed-length element wise loops over the packet,
+        *          which the compiler lowers to a single SSE/AVX/AVX-512/NEON instruction per operation.
+        *          define 'MAKELAZY_DISABLE_SIMD' to force scalar evaluation.
         **/
-        template<typename LeftExpr, typename BinaryOp, typename RightExpr>
-        class BinaryExpression {
+        namespace Simd {
 
-            // properties
-            private:
-                const LeftExpr  m_left;
-                const RightExpr m_right;
+            // SIMD register width (in bytes)
+#if defined(__AVX512F__)
+            constexpr std::size_t width{ 64 };
+#elif defined(__AVX__)
+            constexpr std::size_t width{ 32 };
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || defined(__ARM_NEON) || defined(__ARM_NEON__)
+            constexpr std::size_t width{ 16 };
+#else
+            constexpr std::size_t width{ 0 };
+#endif
 
-            // constructors
-            public:
-                // prohibit empty constructor
-                BinaryExpression() = delete;
+            // is packet evaluation enabled?
+#if defined(MAKELAZY_DISABLE_SIMD)
+            constexpr bool enabled{ false };
+#else
+            constexpr bool enabled{ width > 0 };
+#endif
 
-                // element wise constructor
-                BinaryExpression(LeftExpr l, RightExpr r) : m_left(std::forward<LeftExpr>(l)), m_right(std::forward<RightExpr>(r)) {}
+            // are packets stored with non temporal (streaming) stores? (see 'Lazy::stream')
+#if defined(MAKELAZY_STREAM)
+            constexpr bool streamed{ true };
+#else
+            constexpr bool streamed{ false };
+#endif
 
-                // expression can not be copied...
-                BinaryExpression(const BinaryExpression&)             = delete;
-                BinaryExpression& operator =(const BinaryExpression&) = delete;
+            // order non temporal stores before the stores which follow them
+            inline void fence() noexcept {
+#if defined(MAKELAZY_STREAM)
+                _mm_sfence();
+#endif
+            }
 
-                // ...only moved
-                BinaryExpression(BinaryExpression&&) noexcept             = default;
-                BinaryExpression& operator =(BinaryExpression&&) noexcept = default;
+            // mask element type (an unsigned integral of the same size as an element)
+            template<std::size_t N> struct mask_of;
+            template<> struct mask_of<1> { using type = std::uint8_t;  };
+            template<> struct mask_of<2> { using type = std::uint16_t; };
+            template<> struct mask_of<4> { using type = std::uint32_t; };
+            template<> struct mask_of<8> { using type = std::uint64_t; };
+            template<typename T> using mask_t = typename mask_of<sizeof(T)>::type;
 
-            // binary operators overload
-            public:
-
-#define CREATE_BINARY_EXPRESSION_OPERATOR(xi_operator)                                                                                                                                          \
-        template<typename RE> auto operator xi_operator(RE&& re) const -> BinaryExpression<const BinaryExpression<LeftExpr, BinaryOp, RightExpr>&, BinaryOp, decltype(std::forward<RE>(re))> {  \
-            return BinaryExpression<const BinaryExpression<LeftExpr, BinaryOp, RightExpr>&, BinaryOp, decltype(std::forward<RE>(re))>(*this, std::forward<RE>(re));                             \
-        }
-
-                CREATE_BINARY_EXPRESSION_OPERATOR(+= );
-                CREATE_BINARY_EXPRESSION_OPERATOR(-= );
-                CREATE_BINARY_EXPRESSION_OPERATOR(*= );
-                CREATE_BINARY_EXPRESSION_OPERATOR(/= );
-                CREATE_BINARY_EXPRESSION_OPERATOR(|= );
-                CREATE_BINARY_EXPRESSION_OPERATOR(&= );
-                CREATE_BINARY_EXPRESSION_OPERATOR(^= );
-                CREATE_BINARY_EXPRESSION_OPERATOR(<<= );
-                CREATE_BINARY_EXPRESSION_OPERATOR(>>= );
-                CREATE_BINARY_EXPRESSION_OPERATOR(+);
-                CREATE_BINARY_EXPRESSION_OPERATOR(-);
-                CREATE_BINARY_EXPRESSION_OPERATOR(*);
-                CREATE_BINARY_EXPRESSION_OPERATOR(/ );
-                CREATE_BINARY_EXPRESSION_OPERATOR(| );
-                CREATE_BINARY_EXPRESSION_OPERATOR(&);
-                CREATE_BINARY_EXPRESSION_OPERATOR(^);
-                CREATE_BINARY_EXPRESSION_OPERATOR(<< );
-                CREATE_BINARY_EXPRESSION_OPERATOR(>> );
-                CREATE_BINARY_EXPRESSION_OPERATOR(&&);
-                CREATE_BINARY_EXPRESSION_OPERATOR(|| );
-                CREATE_BINARY_EXPRESSION_OPERATOR(== );
-                CREATE_BINARY_EXPRESSION_OPERATOR(!= );
-                CREATE_BINARY_EXPRESSION_OPERATOR(< );
-                CREATE_BINARY_EXPRESSION_OPERATOR(<= );
-                CREATE_BINARY_EXPRESSION_OPERATOR(> );
-                CREATE_BINARY_EXPRESSION_OPERATOR(>= );
-#undef CREATE_BINARY_EXPRESSION_OPERATOR
+            /**
+            * \brief a packet of (arithmetic) elements which fit a SIMD register
+            *
+            * @param {T, in} element type
+            **/
+            template<typename T> struct Packet {
+                // amount of elements in packet
+                static constexpr std::size_t size{ (width / sizeof(T) > 0) ? (width / sizeof(T)) : 1 };
 
-            // getters
-            public:
+                // packet elements
+                T v[size];
+
+                // load a packet from (unaligned) memory
+                static Packet load(const T* xi_ptr) noexcept {
+                    Packet p;
+                    std::memcpy(p.v, xi_ptr, sizeof(p.v));
+                    return p;
+                }
 
-                // expression left hand side
-                auto le()       -> typename std::add_lvalue_reference<                        LeftExpr>       ::type { return m_left; }
-                auto le() const -> typename std::add_lvalue_reference<typename std::add_const<LeftExpr>::type>::type { return m_left; }
+                // store a packet to (unaligned) memory
+                void store(T* xi_ptr) const noexcept {
+                    std::memcpy(xi_ptr, v, sizeof(v));
+                }
 
-                // expression right hand side
-                auto re()       -> typename std::add_lvalue_reference<                        RightExpr>       ::type { return m_right; }
-                auto re() const -> typename std::add_lvalue_reference<typename std::add_const<RightExpr>::type>::type { return m_right; }
+                // store a packet to memory aligned to the register width, bypassing the cache (see 'fence')
+                void stream(T* xi_ptr) const noexcept {
+#if defined(MAKELAZY_STREAM) && defined(__AVX512F__)
+                    _mm512_stream_si512(reinterpret_cast<__m512i*>(xi_ptr), _mm512_loadu_si512(static_cast<const void*>(v)));
+#elif defined(MAKELAZY_STREAM) && defined(__AVX__)
+                    _mm256_stream_si256(reinterpret_cast<__m256i*>(xi_ptr), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(v)));
+#elif defined(MAKELAZY_STREAM)
+                    _mm_stream_si128(reinterpret_cast<__m128i*>(xi_ptr), _mm_loadu_si128(reinterpret_cast<const __m128i*>(v)));
+#else
+                    store(xi_ptr);
+#endif
+                }
 
-                // [] overload to get expression at a specific index
-                auto operator [](std::size_t index) const -> decltype(BinaryOp::apply(this->le()[index], this->re()[index])) {
-                    return BinaryOp::apply(le()[index], re()[index]);
+                // a packet whose elements are selected (bitwise) from two packets according to a mask packet (blend)
+                template<typename M> static Packet select(const M& xi_mask, const Packet& xi_true, const Packet& xi_false) noexcept {
+                    static_assert(sizeof(M) == sizeof(Packet), "Packet::select: mask and packet are of different size.");
+                    M t, f;
+                    std::memcpy(t.v, xi_true.v,  sizeof(t.v));
+                    std::memcpy(f.v, xi_false.v, sizeof(f.v));
+                    for (std::size_t i{}; i < M::size; ++i) {
+                        t.v[i] = static_cast<decltype(t.v[i] + 0)>((xi_mask.v[i] & t.v[i]) | (~xi_mask.v[i] & f.v[i]));
+                    }
+                    Packet p;
+                    std::memcpy(p.v, t.v, sizeof(p.v));
+                    return p;
                 }
+
+                // a packet whose elements all equal a given value
+                static Packet broadcast(const T& xi_value) noexcept {
+                    Packet p;
+                    for (std::size_t i{}; i < size; ++i) {
+                        p.v[i] = xi_value;
+                    }
+                    return p;
+                }
+            };
+        };
+
+        // amount of elements of an expression which does not bound it (i.e. - a broadcast scalar)
+        constexpr std::size_t unbounded{ std::numeric_limits<std::size_t>::max() };
+
+        // test if the amount of elements of two operands match (a broadcast scalar matches any amount)
+        constexpr bool matching_size(std::size_t xi_a, std::size_t xi_b) noexcept {
+            return (xi_a == xi_b) || (xi_a == unbounded) || (xi_b == unbounded);
+        }
+
+        // compile time amount of elements of an expression whose amount of elements is only known at runtime
+        constexpr std::size_t dynamic_extent{ unbounded - 1 };
+
+        // compile time amount of elements of an expression over two operands (a static extent is kept over a dynamic one, and any extent over a broadcast scalar)
+        constexpr std::size_t common_extent(std::size_t xi_a, std::size_t xi_b) noexcept {
+            return ((xi_a == unbounded) || ((xi_a == dynamic_extent) && (xi_b != unbounded))) ? xi_b : xi_a;
+        }
+
+        // test if the compile time amount of elements of two operands can match
+        constexpr bool matching_extent(std::size_t xi_a, std::size_t xi_b) noexcept {
+            return (xi_a == xi_b) || (xi_a >= dynamic_extent) || (xi_b >= dynamic_extent);
+        }
+
+        // maximal amount of iterations which are fully unrolled when evaluating an expression of static extent
+        constexpr std::size_t unroll_limit{ 16 };
+
+        // invoke a callable with every index in [0, N) as a compile time constant (a fully unrolled loop)
+        template<typename F, std::size_t... I> constexpr void unroll(F&& xi_function, std::index_sequence<I...>) {
+            (xi_function(std::integral_constant<std::size_t, I>{}), ...);
+        }
+        template<std::size_t N, typename F> constexpr void unroll(F&& xi_function) {
+            unroll(std::forward<F>(xi_function), std::make_index_sequence<N>{});
+        }
+
+        // is evaluation taking place at compile time? (packets are never evaluated at compile time)
+        constexpr bool is_constant_evaluated() noexcept {
+#if defined(__cpp_lib_is_constant_evaluated)
+            return std::is_constant_evaluated();
+#elif defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+            return __builtin_is_constant_evaluated();
+#else
+            return false;
+#endif
+        }
+
+        // cache line size (in bytes), parallel chunks are aligned to it to avoid false sharing
+        constexpr std::size_t cache_line{ 64 };
+
+        // default amount of bytes (per operand) of a tile evaluated by 'Lazy::tiled', so all operands of a tile fit in L1/L2
+        constexpr std::size_t tile_bytes{ 1 << 13 };
+
+        // default amount of destination bytes above which 'Lazy::stream' bypasses the cache (about the size of a last level cache)
+        constexpr std::size_t stream_bytes{ 1 << 23 };
+
+        // hint the processor to fetch (for reading) the cache lines holding the start of a range of elements
+        // (at most a tile, so prefetching ahead of a large range, i.e. - a batch, does not evict the range being evaluated)
+        template<typename T> void prefetch(const T* xi_first, const T* xi_last) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            const char* first{ reinterpret_cast<const char*>(xi_first) };
+            const char* last{ first + std::min<std::size_t>(tile_bytes, static_cast<std::size_t>(xi_last - xi_first) * sizeof(T)) };
+            for (const char* p{ first }; p < last; p += cache_line) {
+                __builtin_prefetch(p, 0, 3);
+            }
+#else
+            (void)xi_first;
+            (void)xi_last;
+#endif
+        }
+
+        /**
+        * aliasing between an expression and its destination (how an expression evaluated at index 'i' reads the destination),
+        * ordered from harmless to restrictive
+        **/
+        enum class Alias {
+            none,        // destination is not read
+            elementwise, // destination is only read at index 'i'
+            forward,     // destination is read at indices >= 'i' (safe to evaluate in place from first to last index)
+            backward,    // destination is read at indices <= 'i' (safe to evaluate in place from last to first index)
+            unknown      // destination is read at arbitrary indices (must be evaluated into a scratch buffer)
+        };
+
+        // aliasing of an expression whose operands alias the destination as 'a' and 'b'
+        constexpr Alias combine(Alias a, Alias b) noexcept {
+            if (a == Alias::none)        return b;
+            if (b == Alias::none)        return a;
+            if (a == Alias::elementwise) return b;
+            if (b == Alias::elementwise) return a;
+            return (a == b) ? a : Alias::unknown;
+        }
+
+        // elements of a destination collection ('offset + i * step'), as tested by the leaves of an expression and destination
+        struct Region {
+            const void*    collection;
+            std::ptrdiff_t offset;
+            std::size_t    step;
         };
 
+        /**
+        * \brief aliasing of a leaf reading some elements of a collection with a destination
+        *
+        * @param {xi_leaf,        in}  elements read by leaf
+        * @param {xi_destination, in}  elements written by destination
+        * @param {return,         out} aliasing
+        *
+        * \remarks elements of equal step are read ahead/behind (or never, if offsets are not a multiple of step apart).
+        **/
+        constexpr Alias alias(const Region& xi_leaf, const Region& xi_destination) noexcept {
+            if (xi_leaf.collection != xi_destination.collection) {
+                return Alias::none;
+            }
+            if (xi_leaf.step != xi_destination.step) {
+                return Alias::unknown;
+            }
+
+            const std::ptrdiff_t distance{ xi_leaf.offset - xi_destination.offset },
+                                 step{ static_cast<std::ptrdiff_t>(xi_leaf.step) };
+            if (distance == 0)        return Alias::elementwise;
+            if (distance % step != 0) return Alias::none;
+            return (distance > 0) ? Alias::forward : Alias::backward;
+        }
+
+        // forward declaration
+        template<typename LeftExpr, typename BinaryOp, typename RightExpr> class BinaryExpression;
+        template<typename T> class Scalar;
+        template<typename Expr, typename UnaryOp> class UnaryExpression;
+        template<typename CondExpr, typename ThenExpr, typename ElseExpr> class WhereExpression;
+        template<typename F, typename... Exprs> class MapExpression;
+        template<typename T, typename BinaryOp, typename... Exprs> class ChainExpression;
+        template<typename COLLECTION> class ConsumeExpression;
+        template<typename Derived> struct ExpressionOperators;
+        template<typename COLLECTION, bool CONTIGUOUS> class Window;
+        namespace BinaryOperations { template<typename T> struct ADD; template<typename T> struct SUB; }
+
         /**
         * concepts
         **/
@@ -109,6 +320,34 @@ namespace Lazy {
             template<typename L, typename B, typename R> struct is_binary_expression<detail::BinaryExpression<L, B, R>> : std::true_type  {};
             template<typename T> constexpr bool is_binary_expression_v = is_binary_expression<T>::value;
 
+            // test if an object is a broadcast scalar
+            template<typename>   struct is_scalar                    : std::false_type {};
+            template<typename T> struct is_scalar<detail::Scalar<T>> : std::true_type  {};
+
+            // test if an object is (or derives from) a lazy container
+            template<typename C> std::true_type  is_container_test(const Lazy::Container<C>*);
+                                 std::false_type is_container_test(...);
+            template<typename T> struct is_container : decltype(is_container_test(std::declval<const T*>())) {};
+
+            // test if an expression is a consumed collection (whose elements are moved from)
+            template<typename>   struct is_consumed                         : std::false_type {};
+            template<typename C> struct is_consumed<ConsumeExpression<C>>   : std::true_type  {};
+
+            // test if a collection is a window over another collection
+            template<typename>           struct is_window                       : std::false_type {};
+            template<typename C, bool K> struct is_window<detail::Window<C, K>> : std::true_type  {};
+
+            // test if an object (of any value category) can be an operand of an expression (expression nodes derive from 'ExpressionOperators')
+            template<typename T> constexpr bool is_expression_v = std::is_base_of_v<detail::ExpressionOperators<std::decay_t<T>>, std::decay_t<T>> ||
+                                                                  is_scalar<std::decay_t<T>>::value                                           ||
+                                                                  is_container<std::decay_t<T>>::value;
+
+            // test if a (left hand) object is a scalar which can be broadcast against a (right hand) expression
+            template<typename S, typename E, typename = void> struct is_scalar_operand : std::false_type {};
+            template<typename S, typename E>                  struct is_scalar_operand<S, E, std::enable_if_t<!is_expression_v<S> && is_expression_v<E>>>
+                                                                                      : std::is_convertible<S, typename std::decay_t<E>::value_type> {};
+            template<typename S, typename E> constexpr bool is_scalar_operand_v = is_scalar_operand<S, E>::value;
+
             // test if an object has the 'size()' method
             template<typename T, typename = void> struct has_size                                                : std::false_type {};
             template<typename T>                  struct has_size<T, decltype(std::declval<T>().size(), void())> : std::true_type  {};
@@ -119,8 +358,112 @@ namespace Lazy {
             template<typename T>                  struct has_access_operator<T, std::void_t<decltype(std::declval<T>()[0])>> : std::true_type  {};
             template<typename T> constexpr bool haa_access_operator_v = has_access_operator<T>::value;
 
-            // test if an object can be wrapped by Lazy::Container
-            template<typename T> constexpr bool can_be_wrapped = has_size_v<T> && haa_access_operator_v<T>;
+            // test if an object has the 'begin()' method (i.e. - can be traversed by iterators)
+            template<typename T, typename = void> struct is_iterable                                                           : std::false_type {};
+            template<typename T>                  struct is_iterable<T, std::void_t<decltype(std::declval<T&>().begin())>> : std::true_type  {};
+
+            // test if an object can be wrapped by Lazy::Container (collections without '[]' operator are traversed by their iterators)
+            template<typename T> constexpr bool can_be_wrapped = has_size_v<T> && (haa_access_operator_v<T> || is_iterable<T>::value);
+
+            // test if an object has the 'data()' method (i.e. - holds its elements contiguously)
+            template<typename T, typename = void> struct has_data                                                                   : std::false_type {};
+            template<typename T>                  struct has_data<T, std::void_t<decltype(std::declval<T&>().data())>>             : std::true_type  {};
+            template<typename T> constexpr bool has_data_v = has_data<T>::value;
+
+            // test if a collection is traversed faster by its iterators than by index (non contiguous collections, i.e. - segmented 'std::deque' or forward only 'std::list')
+            template<typename T> constexpr bool is_segmented_collection_v = is_iterable<T>::value && !has_data_v<T>;
+
+            // test if an expression reads a segmented collection (so it is evaluated through cursors)
+            template<typename T, typename = void> struct is_segmented                                                        : std::false_type {};
+            template<typename T>                  struct is_segmented<T, std::enable_if_t<std::decay_t<T>::is_segmented>> : std::true_type  {};
+            template<typename T> constexpr bool is_segmented_v = is_segmented<std::decay_t<T>>::value;
+
+            // test if a collection has the 'advise(first, last)' method (i.e. - a memory mapped file, which is told which elements are read next)
+            template<typename T, typename = void> struct has_advise                                                                                         : std::false_type {};
+            template<typename T>                  struct has_advise<T, std::void_t<decltype(std::declval<T&>().advise(std::size_t{}, std::size_t{}))>> : std::true_type  {};
+
+            // test if an expression has the 'cursor(index)' method
+            template<typename T, typename = void> struct has_cursor                                                                      : std::false_type {};
+            template<typename T>                  struct has_cursor<T, std::void_t<decltype(std::declval<const T&>().cursor(std::size_t{}))>> : std::true_type  {};
+
+            // compile time amount of elements of a collection (collections with a tuple size, i.e. - 'std::array', have a static extent)
+            template<typename T, typename = void> struct static_extent                                                      : std::integral_constant<std::size_t, dynamic_extent>         {};
+            template<typename T>                  struct static_extent<T, std::void_t<decltype(std::tuple_size<T>::value)>> : std::integral_constant<std::size_t, std::tuple_size<T>::value> {};
+
+            // compile time amount of elements of an expression (nodes without an 'extent' are of dynamic extent)
+            template<typename T, typename = void> struct extent                                                    : std::integral_constant<std::size_t, dynamic_extent>                 {};
+            template<typename T>                  struct extent<T, std::void_t<decltype(std::decay_t<T>::extent)>> : std::integral_constant<std::size_t, std::decay_t<T>::extent> {};
+            template<typename T> constexpr std::size_t extent_v = extent<std::decay_t<T>>::value;
+
+            // is an expression of a bounded amount of elements? (an expression of broadcast scalars only is not)
+            template<typename T> constexpr bool is_bounded_v = extent_v<T> != unbounded;
+
+            // test if a binary operation has a packet (SIMD) 'apply' overload for a given element type
+            template<typename OP, typename T, typename = void> struct has_packet_apply : std::false_type {};
+            template<typename OP, typename T>                  struct has_packet_apply<OP, T, std::void_t<decltype(OP::apply(std::declval<const Simd::Packet<T>&>(),
+                                                                                                                       std::declval<const Simd::Packet<T>&>()))>> : std::true_type {};
+            template<typename OP, typename T> constexpr bool has_packet_apply_v = has_packet_apply<OP, T>::value;
+
+            // test if a relation operation has a mask packet overload for a given element type
+            template<typename OP, typename T, typename = void> struct has_packet_mask : std::false_type {};
+            template<typename OP, typename T>                  struct has_packet_mask<OP, T, std::void_t<decltype(OP::mask(std::declval<const Simd::Packet<T>&>(),
+                                                                                                                     std::declval<const Simd::Packet<T>&>()))>> : std::true_type {};
+
+            // test if a (condition) expression yields a mask packet whose lanes match packets of a given element type
+            template<typename E, typename T, typename = void> struct is_maskable : std::false_type {};
+            template<typename E, typename T>                  struct is_maskable<E, T, std::enable_if_t<std::decay_t<E>::is_maskable>>
+                                                                                 : std::bool_constant<decltype(std::declval<const std::decay_t<E>&>().mask(0))::size == Simd::Packet<T>::size> {};
+            template<typename E, typename T> constexpr bool is_maskable_v = is_maskable<E, T>::value;
+
+            // test if a unary operation has a packet (SIMD) 'apply' overload for a given element type
+            template<typename OP, typename T, typename = void> struct has_unary_packet_apply : std::false_type {};
+            template<typename OP, typename T>                  struct has_unary_packet_apply<OP, T, std::void_t<decltype(OP::apply(std::declval<const Simd::Packet<T>&>()))>> : std::true_type {};
+
+            // test if an element can be built by appending to (and reserving) it, i.e. - strings
+            template<typename T, typename = void> struct is_concatenable : std::false_type {};
+            template<typename T>                  struct is_concatenable<T, std::void_t<decltype(std::declval<T&>().reserve(std::size_t{})),
+                                                                                        decltype(std::declval<T&>().append(std::declval<const T&>())),
+                                                                                        decltype(std::declval<T&>().clear()),
+                                                                                        decltype(std::declval<const T&>().capacity())>> : std::true_type {};
+
+            // test if an expression is a concatenation (an addition of concatenable elements)
+            template<typename>                           struct is_concatenation                                                              : std::false_type    {};
+            template<typename L, typename T, typename R> struct is_concatenation<detail::BinaryExpression<L, BinaryOperations::ADD<T>, R>> : is_concatenable<T> {};
+            template<typename T> constexpr bool is_concatenation_v = is_concatenation<std::decay_t<T>>::value;
+
+            // test if an element is added to (subtracted from) in place by an additive operation, i.e. - a structure holding strings
+            // (arithmetic elements are evaluated in registers, and concatenable elements are reserved and appended to)
+            template<typename OP, typename T, typename = void> struct is_accumulable : std::false_type {};
+            template<typename T> struct is_accumulable<BinaryOperations::ADD<T>, T, std::void_t<decltype(std::declval<T&>() += std::declval<const T&>())>>
+                                                                                                     : std::bool_constant<!std::is_arithmetic_v<T> && !is_concatenable<T>::value> {};
+            template<typename T> struct is_accumulable<BinaryOperations::SUB<T>, T, std::void_t<decltype(std::declval<T&>() -= std::declval<const T&>())>>
+                                                                                                     : std::bool_constant<!std::is_arithmetic_v<T> && !is_concatenable<T>::value> {};
+
+            // test if an expression is an accumulation (a left nested chain of additive operations over elements added to in place)
+            template<typename>                           struct is_accumulation                                        : std::false_type {};
+            template<typename L, typename B, typename R> struct is_accumulation<detail::BinaryExpression<L, B, R>> : is_accumulable<B, typename detail::BinaryExpression<L, B, R>::value_type> {};
+            template<typename T> constexpr bool is_accumulation_v = is_accumulation<std::decay_t<T>>::value;
+
+            // test if an expression keeps state between evaluations of its elements (so it can not be evaluated concurrently)
+            template<typename T, typename = void> struct is_stateful                                                       : std::false_type {};
+            template<typename T>                  struct is_stateful<T, std::enable_if_t<std::decay_t<T>::is_stateful>> : std::true_type  {};
+            template<typename T> constexpr bool is_stateful_v = is_stateful<std::decay_t<T>>::value;
+
+            // test if an expression has the 'prepare(first, last)' method
+            template<typename T, typename = void> struct has_prepare                                                                                          : std::false_type {};
+            template<typename T>                  struct has_prepare<T, std::void_t<decltype(std::declval<const T&>().prepare(std::size_t{}, std::size_t{}))>> : std::true_type  {};
+        }
+
+        /**
+        * \brief prepare the evaluation of an index range of an expression (nodes without 'prepare' need no preparation).
+        *
+        * \remarks called by tiled evaluation before every tile: caching nodes materialize the tile and leaves prefetch the
+        *          following tile. an empty range discards any prepared (or remembered) state, and is called before every evaluation.
+        **/
+        template<typename E> constexpr void prepare(const E& xi_expression, std::size_t xi_first, std::size_t xi_last) {
+            if constexpr (Concepts::has_prepare<std::decay_t<E>>::value) {
+                xi_expression.prepare(xi_first, xi_last);
+            }
         }
 
         /**
@@ -131,10 +474,23 @@ namespace Lazy {
 #define CREATE_BINARY_OPERATION(xi_name, xi_operator, xi_assign_operator)                                      \
         template<typename T>                                                                                   \
         struct xi_name {                                                                                       \
+            static constexpr const char* symbol{ #xi_operator };                                               \
             constexpr static T apply(const T& a, const T& b) { return a xi_operator b;                      }  \
             constexpr static T apply(T&&      a, const T& b) { a xi_assign_operator b; return std::move(a); }  \
-            constexpr static T apply(const T& a, T&&      b) { b xi_assign_operator a; return std::move(b); }  \
+            constexpr static T apply(const T& a, T&&      b) { return a xi_operator std::move(b);           }  \
             constexpr static T apply(T&&      a, T&&      b) { a xi_assign_operator b; return std::move(a); }  \
+                                                                                                               \
+            template<typename D, typename U> constexpr static void assign(D&& a, U&& b) {                      \
+                a xi_assign_operator std::forward<U>(b);                                                       \
+            }                                                                                                  \
+                                                                                                               \
+            static Simd::Packet<T> apply(const Simd::Packet<T>& a, const Simd::Packet<T>& b) noexcept {        \
+                Simd::Packet<T> out;                                                                           \
+                for (std::size_t i{}; i < Simd::Packet<T>::size; ++i) {                                        \
+                    out.v[i] = static_cast<T>(a.v[i] xi_operator b.v[i]);                                      \
+                }                                                                                              \
+                return out;                                                                                    \
+            }                                                                                                  \
         }
 
             CREATE_BINARY_OPERATION(ADD,  +,   +=);
@@ -148,9 +504,19 @@ namespace Lazy {
             CREATE_BINARY_OPERATION(SHR,  >> , >>=);
 #undef CREATE_BINARY_OPERATION
 
+            // assignment (evaluation of an expression into a container)
+            template<typename T> struct ASSIGN {
+                static constexpr const char* symbol{ "=" };
+
+                template<typename D, typename U> constexpr static void assign(D&& a, U&& b) { a = std::forward<U>(b); }
+
+                static Simd::Packet<T> apply(const Simd::Packet<T>&, const Simd::Packet<T>& b) noexcept { return b; }
+            };
+
             // relation/logical operator overloading
 #define CREATE_BINARY_OPERATION(xi_name, xi_operator)                                         \
         template<typename T> struct xi_name {                                                 \
+            static constexpr const char* symbol{ #xi_operator };                              \
             constexpr static bool apply(const T& a, const T& b) { return a xi_operator b; }   \
             constexpr static bool apply(T&&      a, const T& b) { return a xi_operator b; }   \
             constexpr static bool apply(const T& a, T&&      b) { return a xi_operator b; }   \
@@ -159,6 +525,27 @@ namespace Lazy {
 
             CREATE_BINARY_OPERATION(AND, &&);
             CREATE_BINARY_OPERATION(OR,  || );
+#undef CREATE_BINARY_OPERATION
+
+            // relation operators also yield a mask packet (all bits set where relation holds) out of two packets.
+#define CREATE_BINARY_OPERATION(xi_name, xi_operator)                                                                   \
+        template<typename T> struct xi_name {                                                                           \
+            static constexpr const char* symbol{ #xi_operator };                                                        \
+            constexpr static bool apply(const T& a, const T& b) { return a xi_operator b; }                             \
+            constexpr static bool apply(T&&      a, const T& b) { return a xi_operator b; }                             \
+            constexpr static bool apply(const T& a, T&&      b) { return a xi_operator b; }                             \
+            constexpr static bool apply(T&&      a, T&&      b) { return a xi_operator b; }                             \
+                                                                                                                        \
+            template<typename U = T>                                                                                    \
+            static Simd::Packet<Simd::mask_t<U>> mask(const Simd::Packet<U>& a, const Simd::Packet<U>& b) noexcept {    \
+                Simd::Packet<Simd::mask_t<U>> out;                                                                      \
+                for (std::size_t i{}; i < Simd::Packet<U>::size; ++i) {                                                 \
+                    out.v[i] = (a.v[i] xi_operator b.v[i]) ? static_cast<Simd::mask_t<U>>(~Simd::mask_t<U>{}) : Simd::mask_t<U>{}; \
+                }                                                                                                       \
+                return out;                                                                                             \
+            }                                                                                                           \
+        }
+
             CREATE_BINARY_OPERATION(EQ,  == );
             CREATE_BINARY_OPERATION(NEQ, != );
             CREATE_BINARY_OPERATION(LT,  < );
@@ -167,128 +554,5584 @@ namespace Lazy {
             CREATE_BINARY_OPERATION(GE,  >= );
 #undef CREATE_BINARY_OPERATION
         };
-    };
 
-    /**
-    * \brief extend a container to be lazy evaluated under operator overloading.
-    *
-    * @param{COLLECTION} the collection/container to be (element wise) lazy evaluated.
-    *                    the container must include the following:
-    *                    > 'size' method (which returns the amount of elements in collection).
-    *                    > '[]' operator which allow access to an element via an index.
-    *
-    * \remarks notice that the underlying element held by the wrapped container must support the
-    *          overloaded operations.
-    **/
-    template<typename COLLECTION> struct Container {
-        // test that container upholds basic requirement
-        static_assert(detail::Concepts::can_be_wrapped<COLLECTION>, "Container<Collection>: Collection can not be wrapped.");
+        namespace Concepts {
+            // test if an operation can trap (or is undefined) on lanes which a mask or condition does not select (integral division and shifts)
+            template<typename>   struct is_trapping                            : std::false_type {};
+            template<typename T> struct is_trapping<BinaryOperations::DIV<T>>  : std::is_integral<T> {};
+            template<typename T> struct is_trapping<BinaryOperations::SHL<T>>  : std::is_integral<T> {};
+            template<typename T> struct is_trapping<BinaryOperations::SHR<T>>  : std::is_integral<T> {};
 
-        //
-        // aliases
-        //
-        using value_type             = typename COLLECTION::value_type;
-        using size_type              = typename COLLECTION::size_type;
-        using difference_type        = typename COLLECTION::difference_type;
-        using reference              = typename COLLECTION::reference;
-        using const_reference        = typename COLLECTION::const_reference;
-        using pointer                = typename COLLECTION::pointer;
-        using const_pointer          = typename COLLECTION::const_pointer;
-        using iterator               = typename COLLECTION::iterator;
-        using const_iterator         = typename COLLECTION::const_iterator;
-        using reverse_iterator       = typename COLLECTION::reverse_iterator;
-        using const_reverse_iterator = typename COLLECTION::const_reverse_iterator;
+            // test if an expression applies an operation which can trap (so it is only evaluated at selected indices, rather than in packets which are blended)
+            template<typename>                                  struct may_trap                                   : std::false_type {};
+            template<typename E, typename U>                    struct may_trap<UnaryExpression<E, U>>            : may_trap<std::decay_t<E>> {};
+            template<typename L, typename B, typename R>        struct may_trap<BinaryExpression<L, B, R>>        : std::bool_constant<is_trapping<B>::value || may_trap<std::decay_t<L>>::value || may_trap<std::decay_t<R>>::value> {};
+            template<typename C, typename T, typename E>        struct may_trap<WhereExpression<C, T, E>>         : std::bool_constant<may_trap<std::decay_t<C>>::value || may_trap<std::decay_t<T>>::value || may_trap<std::decay_t<E>>::value> {};
+            template<typename F, typename... Exprs>             struct may_trap<MapExpression<F, Exprs...>>       : std::bool_constant<(may_trap<std::decay_t<Exprs>>::value || ...)> {};
+            template<typename T, typename B, typename... Exprs> struct may_trap<ChainExpression<T, B, Exprs...>>  : std::bool_constant<is_trapping<B>::value || (may_trap<std::decay_t<Exprs>>::value || ...)> {};
+            template<typename T> constexpr bool may_trap_v = may_trap<std::decay_t<T>>::value;
+        }
 
-        //
-        // constructors
-        // 
+        /**
+        * unary operations
+        **/
+        namespace UnaryOperations {
 
-        // standard constructor
-        constexpr Container(COLLECTION& xi_col) : m_container(xi_col) {}
+            // numerical/bit operations
+#define CREATE_UNARY_OPERATION(xi_name, xi_operator)                                                  \
+        template<typename T> struct xi_name {                                                         \
+            static constexpr const char* symbol{ #xi_operator };                                      \
+            constexpr static T apply(const T& a) { return static_cast<T>(xi_operator a);            } \
+            constexpr static T apply(T&&      a) { return static_cast<T>(xi_operator std::move(a)); } \
+                                                                                                      \
+            static Simd::Packet<T> apply(const Simd::Packet<T>& a) noexcept {                         \
+                Simd::Packet<T> out;                                                                  \
+                for (std::size_t i{}; i < Simd::Packet<T>::size; ++i) {                               \
+                    out.v[i] = static_cast<T>(xi_operator a.v[i]);                                    \
+                }                                                                                     \
+                return out;                                                                           \
+            }                                                                                         \
+        }
 
-        // construct from a binary expression
-        template<typename T, typename std::enable_if<detail::Concepts::is_binary_expression_v<T>>::type* = nullptr>
-        Container(T&& xi_expression) noexcept {
-            for (std::size_t i{}; i < m_container.size(); ++i) {
-                m_container[i] = std::move(xi_expression[i]);
+            CREATE_UNARY_OPERATION(NEG,    -);
+            CREATE_UNARY_OPERATION(BITNOT, ~);
+#undef CREATE_UNARY_OPERATION
+
+            // logical operations
+            template<typename T> struct NOT {
+                static constexpr const char* symbol{ "!" };
+                constexpr static bool apply(const T& a) { return !a; }
+            };
+        };
+
+        /**
+        * \brief a scalar broadcast to every index of an expression (held by value and never indexed through memory)
+        *
+        * @param {T, in} scalar type
+        **/
+        template<typename T> class Scalar {
+
+            // properties
+            private:
+                T m_value;
+
+            // aliases
+            public:
+                using value_type = T;
+
+            // constructors
+            public:
+                Scalar() = delete;
+                explicit constexpr Scalar(T xi_value) : m_value(std::move(xi_value)) {}
+
+            // getters
+            public:
+
+                // can scalar be evaluated in packets?
+                static constexpr bool is_vectorizable = Simd::enabled && std::is_arithmetic_v<T>;
+
+                // a scalar does not bound the amount of elements of an expression
+                constexpr std::size_t size() const noexcept { return unbounded; }
+                static constexpr std::size_t extent = unbounded;
+
+                // a scalar never reads the destination
+                static constexpr bool is_elementwise = true;
+                constexpr Alias alias(const Region&) const noexcept { return Alias::none; }
+
+                // the scalar, at every index
+                constexpr const T& operator [](std::size_t) const noexcept { return m_value; }
+
+                // a packet filled with the scalar
+                Simd::Packet<T> packet(std::size_t) const noexcept { return Simd::Packet<T>::broadcast(m_value); }
+        };
+
+        namespace Concepts {
+            // test if an expression is an (intermediate) node, rather than a leaf (collection, cache, materialized evaluation or file)
+            template<typename>                                struct is_node                                   : std::false_type {};
+            template<typename T>                              struct is_node<Scalar<T>>                        : std::true_type  {};
+            template<typename E, typename U>                  struct is_node<UnaryExpression<E, U>>            : std::true_type  {};
+            template<typename L, typename B, typename R>      struct is_node<BinaryExpression<L, B, R>>        : std::true_type  {};
+            template<typename C, typename T, typename E>      struct is_node<WhereExpression<C, T, E>>         : std::true_type  {};
+            template<typename F, typename... Exprs>           struct is_node<MapExpression<F, Exprs...>>       : std::true_type  {};
+            template<typename T, typename B, typename... Exprs> struct is_node<ChainExpression<T, B, Exprs...>> : std::true_type  {};
+            template<typename T> constexpr bool is_node_v = is_node<std::decay_t<T>>::value;
+        }
+
+        // expression storage type: nodes and temporaries are held by value, other leaves by reference (so an expression outlives the statement building it)
+        template<typename E> struct storage {
+            static_assert(Concepts::is_node_v<E> || std::is_lvalue_reference_v<E> || std::is_move_constructible_v<std::decay_t<E>>,
+                          "expression: a temporary which can not be moved can not be an operand (name it first).");
+            using type = std::conditional_t<Concepts::is_node_v<E> || !std::is_lvalue_reference_v<E>, std::decay_t<E>, E&&>;
+        };
+        template<typename E> using stored_t = typename storage<E>::type;
+
+        // expression operand type: expressions are stored (see 'stored_t'), anything else is broadcast as a 'Scalar<T>'
+        template<typename E, typename T> using operand_t = typename std::conditional<Concepts::is_expression_v<E>, stored_t<E>, Scalar<T>>::type;
+
+        // turn an object into an expression operand
+        template<typename T, typename E> constexpr operand_t<E, T> operand(E&& xi_object) {
+            if constexpr (Concepts::is_expression_v<E>) {
+                return std::forward<E>(xi_object);
+            } else {
+                return Scalar<T>(static_cast<T>(std::forward<E>(xi_object)));
             }
         }
 
-        // assign from a (right) expression
-        template<typename T, typename std::enable_if<detail::Concepts::is_binary_expression_v<T>>::type * = nullptr>
-        Container& operator =(T&& xi_expression) noexcept {
-            for (std::size_t i{}; i < m_container.size(); ++i) {
-                m_container[i] = std::move(xi_expression[i]);
+        // element type an operation between two element types is evaluated in (arithmetic elements of different types are promoted by the
+        // usual arithmetic conversions, i.e. - 'float' and 'double' into 'double', anything else is evaluated in the left element type)
+        template<typename L, typename R, typename = void> struct promoted { using type = L; };
+        template<typename L, typename R>                  struct promoted<L, R, std::enable_if_t<!std::is_same_v<L, R> && std::is_arithmetic_v<L> && std::is_arithmetic_v<R> &&
+                                                                                                 !std::is_same_v<L, bool> && !std::is_same_v<R, bool>>> { using type = std::common_type_t<L, R>; };
+
+        // element type of a binary operation between an expression and an operand (a broadcast scalar is of the expression element type)
+        template<typename D, typename RE> using operation_t = typename promoted<typename D::value_type, typename std::decay_t<operand_t<RE, typename D::value_type>>::value_type>::type;
+
+        // element type of an operation (i.e. - 'double' for 'BinaryOperations::ADD<double>')
+        template<typename>                                struct operation_value;
+        template<template<typename> class OP, typename T> struct operation_value<OP<T>> { using type = T; };
+        template<typename OP> using operation_value_t = typename operation_value<OP>::type;
+
+        namespace Concepts {
+            // test if an expression can be evaluated as packets of a given element type (arithmetic elements are converted per lane)
+            template<typename E, typename T> struct has_packet_of : std::bool_constant<std::decay_t<E>::is_vectorizable && (std::is_same_v<typename std::decay_t<E>::value_type, T> ||
+                                                                                                                          (std::is_arithmetic_v<typename std::decay_t<E>::value_type> && std::is_arithmetic_v<T>))> {};
+            template<typename E, typename T> constexpr bool has_packet_of_v = has_packet_of<E, T>::value;
+        }
+
+        /**
+        * \brief the packet of a given element type starting at a specific index of a (vectorizable) expression of any arithmetic element type
+        *
+        * @param {T,             in}  packet element type
+        * @param {xi_expression, in}  expression
+        * @param {xi_index,      in}  index of first packet element
+        * @param {return,        out} packet
+        *
+        * \remarks elements are widened (or narrowed) by fixed length loops, which the compiler lowers to vector convert instructions.
+        *          an expression of elements at least as wide is read as packets, while an expression of narrower elements (whose packets
+        *          hold more elements than are needed, and might cross the end of the expression) is read element wise.
+        **/
+        template<typename T, typename E> Simd::Packet<T> packet_as(const E& xi_expression, std::size_t xi_index) {
+            using element_type = typename std::decay_t<E>::value_type;
+            using packet_type  = Simd::Packet<T>;
+
+            if constexpr (std::is_same_v<element_type, T>) {
+                return xi_expression.packet(xi_index);
+            } else if constexpr (Simd::Packet<element_type>::size <= packet_type::size) {
+                constexpr std::size_t lanes{ Simd::Packet<element_type>::size };
+                packet_type out;
+                for (std::size_t k{}; k < packet_type::size; k += lanes) {
+                    const Simd::Packet<element_type> in{ xi_expression.packet(xi_index + k) };
+                    for (std::size_t j{}; j < lanes; ++j) {
+                        out.v[k + j] = static_cast<T>(in.v[j]);
+                    }
+                }
+                return out;
+            } else {
+                packet_type out;
+                for (std::size_t k{}; k < packet_type::size; ++k) {
+                    out.v[k] = static_cast<T>(xi_expression[xi_index + k]);
+                }
+                return out;
             }
-            return *this;
         }
 
-        // copy semantics
-        Container(const Container&)              = default;
-        Container& operator = (const Container&) = default;
+        /**
+        * cursors read the elements of an expression in index order: '*c' is the element at the cursor, and '++c' advances it to the following index.
+        * leaves are read through a pointer or an iterator of their collection, so segmented collections (i.e. - 'std::deque') are traversed
+        * segment by segment (an iterator crosses a segment boundary once per segment) instead of translating every index into a segment.
+        **/
 
-        // move semantics
-        Container(Container&&) noexcept              = default;
-        Container& operator = (Container&&) noexcept = default;
+        // a cursor reading an expression by index (expressions without a 'cursor' method)
+        template<typename E> class IndexCursor {
+            // properties
+            private:
+                const E*    m_expression;
+                std::size_t m_index;
 
-        //
-        // access operator
-        //
-        auto operator[] (typename size_type i)       { return m_container[i]; }
-        auto operator[] (typename size_type i) const { return m_container[i]; }
+            public:
+                IndexCursor(const E& xi_expression, std::size_t xi_index) noexcept : m_expression(&xi_expression), m_index(xi_index) {}
 
-        //
-        // operator overloading
-        //
-        
-#define M_OPERATOR_OVERLOAD(OP, AOP, NAME)                                                                                                                                                                                                   \
-        template<typename RightExpr, typename std::enable_if<std::is_convertible_v<RightExpr, value_type>>::type* = nullptr>                                                                                                                 \
-        Container& operator AOP (RightExpr&& xi_expression) {                                                                                                                                                                                \
-            for (std::size_t i{}; i < m_container.size(); ++i) {                                                                                                                                                                             \
-                m_container[i] AOP static_cast<value_type>(xi_expression);                                                                                                                                                                   \
-            }                                                                                                                                                                                                                                \
-            return *this;                                                                                                                                                                                                                    \
-        }                                                                                                                                                                                                                                    \
-        template<typename T, typename std::enable_if<detail::Concepts::is_binary_expression_v<T>>::type* = nullptr>                                                                                                                          \
-        Container& operator AOP (T&& xi_expression) {                                                                                                                                                                                        \
-            for (std::size_t i{}; i < m_container.size(); ++i) {                                                                                                                                                                             \
-                m_container[i] AOP std::move(xi_expression[i]);                                                                                                                                                                              \
-            }                                                                                                                                                                                                                                \
-            return *this;                                                                                                                                                                                                                    \
-        }                                                                                                                                                                                                                                    \
-        template<typename RightExpr> auto operator OP (RightExpr&& xi_expression) const -> detail::BinaryExpression<const Container&, detail::BinaryOperations::ADD<value_type>, decltype(std::forward<RightExpr>(xi_expression))> {         \
-            return detail::BinaryExpression<const Container&, NAME, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));                                                                        \
-        }                                                                                                                                                                                                                                    \
+                decltype(auto) operator *() const { return (*m_expression)[m_index]; }
+                IndexCursor& operator ++() noexcept { ++m_index; return *this; }
+        };
 
-        M_OPERATOR_OVERLOAD(+,  +=,  detail::BinaryOperations::ADD<value_type>);
-        M_OPERATOR_OVERLOAD(-,  -=,  detail::BinaryOperations::SUB<value_type>);
-        M_OPERATOR_OVERLOAD(*,  *=,  detail::BinaryOperations::MUL<value_type>);
-        M_OPERATOR_OVERLOAD(/,  /=,  detail::BinaryOperations::DIV<value_type>);
-        M_OPERATOR_OVERLOAD(&,  &=,  detail::BinaryOperations::LAND<value_type>);
-        M_OPERATOR_OVERLOAD(|,  |=,  detail::BinaryOperations::LOR<value_type>);
-        M_OPERATOR_OVERLOAD(^,  ^=,  detail::BinaryOperations::LXOR<value_type>);
-        M_OPERATOR_OVERLOAD(<<, <<=, detail::BinaryOperations::SHL<value_type>);
-        M_OPERATOR_OVERLOAD(>>, >>=, detail::BinaryOperations::SHR<value_type>);
+        // a cursor applying a callable (invoked with the cursors) to the cursors of the operands of an expression, which are advanced together
+        template<typename F, typename... Cursors> class ApplyCursor {
+            // properties
+            private:
+                F                      m_function;
+                std::tuple<Cursors...> m_cursors;
 
-#undef M_OPERATOR_OVERLOAD
+            public:
+                ApplyCursor(F xi_function, Cursors... xi_cursors) : m_function(std::move(xi_function)), m_cursors(std::move(xi_cursors)...) {}
 
+                decltype(auto) operator *() const { return std::apply(m_function, m_cursors); }
+                ApplyCursor& operator ++() {
+                    std::apply([](auto&... cursors) { (++cursors, ...); }, m_cursors);
+                    return *this;
+                }
+        };
 
-#define M_OPERATOR_OVERLOADING(OP, NAME)                                                                                                                                                                                              \
-        template<typename RightExpr> auto operator OP (RightExpr&& xi_expression) const -> detail::BinaryExpression<const Container&, detail::BinaryOperations::EQ<value_type>, decltype(std::forward<RightExpr>(xi_expression))> {   \
-            return detail::BinaryExpression<const Container&, NAME, decltype(std::forward<RightExpr>(xi_expression))>(*this, std::forward<RightExpr>(xi_expression));                                                                 \
+        // a cursor over an expression, starting at a specific index
+        template<typename E> auto cursor(const E& xi_expression, std::size_t xi_index) {
+            if constexpr (Concepts::has_cursor<E>::value) {
+                return xi_expression.cursor(xi_index);
+            } else {
+                return IndexCursor<E>(xi_expression, xi_index);
+            }
         }
 
-        M_OPERATOR_OVERLOADING(== , detail::BinaryOperations::EQ<value_type>);
-        M_OPERATOR_OVERLOADING(!= , detail::BinaryOperations::NEQ<value_type>);
-        M_OPERATOR_OVERLOADING(< , detail::BinaryOperations::LT<value_type>);
-        M_OPERATOR_OVERLOADING(<= , detail::BinaryOperations::LE<value_type>);
-        M_OPERATOR_OVERLOADING(> , detail::BinaryOperations::GT<value_type>);
-        M_OPERATOR_OVERLOADING(>= , detail::BinaryOperations::GE<value_type>);
+        /**
+        * \brief operators shared by all expression nodes (CRTP base).
+        *
+        * @param {Derived, in} expression node type (must define 'value_type')
+        *
+        * \remarks every operator builds its own node, so C++ operator precedence shapes the tree.
+        **/
+        template<typename Derived> struct ExpressionOperators {
 
-#undef M_OPERATOR_OVERLOADING
+#define CREATE_BINARY_EXPRESSION_OPERATOR(xi_operator, xi_name)                                                                                                                               \
+        template<typename RE, typename D = Derived>                                                                                                                                           \
+        constexpr auto operator xi_operator(RE&& re) const& -> BinaryExpression<stored_t<const D&>, BinaryOperations::xi_name<operation_t<D, RE>>, operand_t<RE, typename D::value_type>> {            \
+            return BinaryExpression<stored_t<const D&>, BinaryOperations::xi_name<operation_t<D, RE>>, operand_t<RE, typename D::value_type>>(static_cast<const D&>(*this),                 \
+                                                                                                                                                  operand<typename D::value_type>(std::forward<RE>(re))); \
+        }                                                                                                                                                                                     \
+        template<typename RE, typename D = Derived>                                                                                                                                           \
+        constexpr auto operator xi_operator(RE&& re) && -> BinaryExpression<stored_t<D>, BinaryOperations::xi_name<operation_t<D, RE>>, operand_t<RE, typename D::value_type>> {                       \
+            return BinaryExpression<stored_t<D>, BinaryOperations::xi_name<operation_t<D, RE>>, operand_t<RE, typename D::value_type>>(static_cast<D&&>(*this),                                \
+                                                                                                                                           operand<typename D::value_type>(std::forward<RE>(re))); \
+        }
 
-        // properties
-        private:
-            COLLECTION& m_container;
+            CREATE_BINARY_EXPRESSION_OPERATOR(+,  ADD);
+            CREATE_BINARY_EXPRESSION_OPERATOR(-,  SUB);
+            CREATE_BINARY_EXPRESSION_OPERATOR(*,  MUL);
+            CREATE_BINARY_EXPRESSION_OPERATOR(/,  DIV);
+            CREATE_BINARY_EXPRESSION_OPERATOR(|,  LOR);
+            CREATE_BINARY_EXPRESSION_OPERATOR(&,  LAND);
+            CREATE_BINARY_EXPRESSION_OPERATOR(^,  LXOR);
+            CREATE_BINARY_EXPRESSION_OPERATOR(<<, SHL);
+            CREATE_BINARY_EXPRESSION_OPERATOR(>>, SHR);
+            CREATE_BINARY_EXPRESSION_OPERATOR(&&, AND);
+            CREATE_BINARY_EXPRESSION_OPERATOR(||, OR);
+            CREATE_BINARY_EXPRESSION_OPERATOR(==, EQ);
+            CREATE_BINARY_EXPRESSION_OPERATOR(!=, NEQ);
+            CREATE_BINARY_EXPRESSION_OPERATOR(<,  LT);
+            CREATE_BINARY_EXPRESSION_OPERATOR(<=, LE);
+            CREATE_BINARY_EXPRESSION_OPERATOR(>,  GT);
+            CREATE_BINARY_EXPRESSION_OPERATOR(>=, GE);
+#undef CREATE_BINARY_EXPRESSION_OPERATOR
+
+#define CREATE_UNARY_EXPRESSION_OPERATOR(xi_operator, xi_name)                                                                         \
+        template<typename D = Derived> constexpr auto operator xi_operator() const& -> UnaryExpression<stored_t<const D&>, UnaryOperations::xi_name<typename D::value_type>> { \
+            return UnaryExpression<stored_t<const D&>, UnaryOperations::xi_name<typename D::value_type>>(static_cast<const D&>(*this));                \
+        }                                                                                                                              \
+        template<typename D = Derived> constexpr auto operator xi_operator() && -> UnaryExpression<stored_t<D>, UnaryOperations::xi_name<typename D::value_type>> { \
+            return UnaryExpression<stored_t<D>, UnaryOperations::xi_name<typename D::value_type>>(static_cast<D&&>(*this));                   \
+        }
+
+            CREATE_UNARY_EXPRESSION_OPERATOR(-, NEG);
+            CREATE_UNARY_EXPRESSION_OPERATOR(~, BITNOT);
+            CREATE_UNARY_EXPRESSION_OPERATOR(!, NOT);
+#undef CREATE_UNARY_EXPRESSION_OPERATOR
+        };
+
+        /**
+        * \brief a unary expression
+        *
+        * @param {Expr,    in} operand
+        * @param {UnaryOp, in} unary operation
+        **/
+        template<typename Expr, typename UnaryOp>
+        class UnaryExpression : public ExpressionOperators<UnaryExpression<Expr, UnaryOp>> {
+
+            // aliases
+            public:
+                // expression value type
+                using value_type = typename std::decay<decltype(UnaryOp::apply(std::declval<const typename std::remove_reference<Expr>::type&>()[0]))>::type;
+
+            // properties
+            private:
+                Expr m_expr;
+
+            // constructors
+            public:
+                // prohibit empty constructor
+                UnaryExpression() = delete;
+
+                // element wise constructor
+                explicit constexpr UnaryExpression(Expr e) : m_expr(std::forward<Expr>(e)) {}
+
+                // expression is cheap to copy (leaves are referenced)
+                UnaryExpression(const UnaryExpression&)                 = default;
+                UnaryExpression& operator =(const UnaryExpression&)     = default;
+                UnaryExpression(UnaryExpression&&) noexcept             = default;
+                UnaryExpression& operator =(UnaryExpression&&) noexcept = default;
+
+            // getters
+            public:
+
+                // expression operand
+                constexpr auto e() const -> const typename std::remove_reference<Expr>::type& { return m_expr; }
+
+                // amount of elements
+                constexpr std::size_t size() const { return e().size(); }
+                static constexpr std::size_t extent = Concepts::extent_v<Expr>;
+
+                // aliasing with destination
+                static constexpr bool is_elementwise = std::decay_t<Expr>::is_elementwise;
+                Alias alias(const Region& xi_destination) const { return e().alias(xi_destination); }
+
+                // does evaluation keep state?
+                static constexpr bool is_stateful = Concepts::is_stateful_v<Expr>;
+
+                // does expression read a segmented collection?
+                static constexpr bool is_segmented = Concepts::is_segmented_v<Expr>;
+
+                // prepare evaluation of an index range
+                constexpr void prepare(std::size_t xi_first, std::size_t xi_last) const { detail::prepare(e(), xi_first, xi_last); }
+
+                // get a cursor starting at a specific index
+                auto cursor(std::size_t index) const {
+                    return ApplyCursor([](const auto& c) -> decltype(auto) { return UnaryOp::apply(*c); }, detail::cursor(e(), index));
+                }
+
+                // can expression be evaluated in packets?
+                static constexpr bool is_vectorizable = std::conjunction_v<std::bool_constant<std::decay_t<Expr>::is_vectorizable>,
+                                                                           Concepts::has_unary_packet_apply<UnaryOp, typename std::decay_t<Expr>::value_type>>;
+
+                // [] overload to get expression at a specific index
+                constexpr auto operator [](std::size_t index) const -> decltype(UnaryOp::apply(this->e()[index])) {
+                    return UnaryOp::apply(e()[index]);
+                }
+
+                // get expression packet (SIMD register) starting at a specific index
+                auto packet(std::size_t index) const {
+                    return UnaryOp::apply(e().packet(index));
+                }
+        };
+
+        /**
+        * \brief a conditional expression, selecting (per index) between two operands
+        *
+        * @param {CondExpr, in} condition
+        * @param {ThenExpr, in} operand selected where condition holds
+        * @param {ElseExpr, in} operand selected where condition does not hold
+        *
+        * \remarks scalar evaluation only evaluates the selected operand, while packet evaluation evaluates both
+        *          operands and blends them (branchless).
+        **/
+        template<typename CondExpr, typename ThenExpr, typename ElseExpr>
+        class WhereExpression : public ExpressionOperators<WhereExpression<CondExpr, ThenExpr, ElseExpr>> {
+
+            // aliases
+            public:
+                // expression value type
+                using value_type = typename std::decay<decltype(true ? std::declval<const typename std::remove_reference<ThenExpr>::type&>()[0]
+                                                                     : std::declval<const typename std::remove_reference<ElseExpr>::type&>()[0])>::type;
+
+            // properties
+            private:
+                CondExpr m_cond;
+                ThenExpr m_then;
+                ElseExpr m_else;
+
+            // constructors
+            public:
+                // prohibit empty constructor
+                WhereExpression() = delete;
+
+                // element wise constructor
+                constexpr WhereExpression(CondExpr c, ThenExpr t, ElseExpr e) : m_cond(std::forward<CondExpr>(c)), m_then(std::forward<ThenExpr>(t)), m_else(std::forward<ElseExpr>(e)) {
+                    assert(matching_size(m_cond.size(), m_then.size()) && matching_size(m_cond.size(), m_else.size()) && matching_size(m_then.size(), m_else.size()));
+                }
+
+                // expression is cheap to copy (leaves are referenced)
+                WhereExpression(const WhereExpression&)                 = default;
+                WhereExpression& operator =(const WhereExpression&)     = default;
+                WhereExpression(WhereExpression&&) noexcept             = default;
+                WhereExpression& operator =(WhereExpression&&) noexcept = default;
+
+            // getters
+            public:
+
+                // expression operands
+                auto ce() const -> const typename std::remove_reference<CondExpr>::type& { return m_cond; }
+                auto te() const -> const typename std::remove_reference<ThenExpr>::type& { return m_then; }
+                auto ee() const -> const typename std::remove_reference<ElseExpr>::type& { return m_else; }
+
+                // amount of elements (operands are of equal size, or broadcast)
+                std::size_t size() const { return std::min<std::size_t>({ ce().size(), te().size(), ee().size() }); }
+                static constexpr std::size_t extent = common_extent(Concepts::extent_v<CondExpr>, common_extent(Concepts::extent_v<ThenExpr>, Concepts::extent_v<ElseExpr>));
+                static_assert(matching_extent(Concepts::extent_v<CondExpr>, Concepts::extent_v<ThenExpr>) && matching_extent(Concepts::extent_v<CondExpr>, Concepts::extent_v<ElseExpr>) &&
+                              matching_extent(Concepts::extent_v<ThenExpr>, Concepts::extent_v<ElseExpr>), "WhereExpression: operands are of different static extent.");
+
+                // aliasing with destination
+                static constexpr bool is_elementwise = std::decay_t<CondExpr>::is_elementwise && std::decay_t<ThenExpr>::is_elementwise && std::decay_t<ElseExpr>::is_elementwise;
+                Alias alias(const Region& xi_destination) const { return combine(ce().alias(xi_destination), combine(te().alias(xi_destination), ee().alias(xi_destination))); }
+
+                // does evaluation keep state?
+                static constexpr bool is_stateful = Concepts::is_stateful_v<CondExpr> || Concepts::is_stateful_v<ThenExpr> || Concepts::is_stateful_v<ElseExpr>;
+
+                // does expression read a segmented collection?
+                static constexpr bool is_segmented = Concepts::is_segmented_v<CondExpr> || Concepts::is_segmented_v<ThenExpr> || Concepts::is_segmented_v<ElseExpr>;
+
+                // get a cursor starting at a specific index (only the selected operand is evaluated)
+                auto cursor(std::size_t index) const {
+                    return ApplyCursor([](const auto& c, const auto& t, const auto& e) -> decltype(auto) { return static_cast<bool>(*c) ? *t : *e; },
+                                       detail::cursor(ce(), index), detail::cursor(te(), index), detail::cursor(ee(), index));
+                }
+
+                // prepare evaluation of an index range
+                constexpr void prepare(std::size_t xi_first, std::size_t xi_last) const {
+                    detail::prepare(ce(), xi_first, xi_last);
+                    detail::prepare(te(), xi_first, xi_last);
+                    detail::prepare(ee(), xi_first, xi_last);
+                }
+
+                // can expression be evaluated in packets? (condition is evaluated per lane, so operands which can trap on unselected lanes are evaluated per element)
+                static constexpr bool is_vectorizable = std::conjunction_v<Concepts::has_packet_of<ThenExpr, value_type>, Concepts::has_packet_of<ElseExpr, value_type>,
+                                                                           std::bool_constant<!Concepts::may_trap_v<ThenExpr> && !Concepts::may_trap_v<ElseExpr>>>;
+
+                // [] overload to get expression at a specific index (only the selected operand is evaluated)
+                decltype(auto) operator [](std::size_t index) const {
+                    return static_cast<bool>(ce()[index]) ? te()[index] : ee()[index];
+                }
+
+                // get expression packet (SIMD register) starting at a specific index
+                auto packet(std::size_t index) const {
+                    return select(ce(), index, packet_as<value_type>(te(), index), packet_as<value_type>(ee(), index));
+                }
+        };
+
+        /**
+        * \brief blend two packets according to a condition expression
+        *
+        * @param {xi_cond,  in}  condition expression
+        * @param {xi_index, in}  index of first packet element
+        * @param {xi_true,  in}  packet selected where condition holds
+        * @param {xi_false, in}  packet selected where condition does not hold
+        * @param {return,   out} blended packet
+        *
+        * \remarks conditions which are relations between vectorizable operands are evaluated as mask packets,
+        *          any other condition is evaluated per element.
+        **/
+        template<typename C, typename P> P select(const C& xi_cond, std::size_t xi_index, const P& xi_true, const P& xi_false) {
+            using element_type = std::remove_const_t<std::remove_reference_t<decltype(xi_true.v[0])>>;
+
+            if constexpr (Concepts::is_maskable_v<C, element_type>) {
+                return P::select(xi_cond.mask(xi_index), xi_true, xi_false);
+            } else {
+                Simd::Packet<Simd::mask_t<element_type>> mask;
+                for (std::size_t i{}; i < P::size; ++i) {
+                    mask.v[i] = static_cast<bool>(xi_cond[xi_index + i]) ? static_cast<Simd::mask_t<element_type>>(~Simd::mask_t<element_type>{}) : Simd::mask_t<element_type>{};
+                }
+                return P::select(mask, xi_true, xi_false);
+            }
+        }
+
+        // value type of an operand which is either an expression or a scalar
+        template<typename E, typename = void> struct operand_value                                              { using type = std::decay_t<E>; };
+        template<typename E>                  struct operand_value<E, std::enable_if_t<Concepts::is_expression_v<E>>> { using type = typename std::decay_t<E>::value_type; };
+
+        /**
+        * \brief length of a concatenation at a specific index, without building it
+        *
+        * \remarks leaves are measured through their references, while other (nested, non concatenation) operands
+        *          can not be measured without being evaluated and are left to grow the output.
+        **/
+        template<typename E> std::size_t concatenated_length(const E& xi_expression, std::size_t xi_index) {
+            if constexpr (Concepts::is_concatenation_v<E>) {
+                return concatenated_length(xi_expression.le(), xi_index) + concatenated_length(xi_expression.re(), xi_index);
+            }
+            else if constexpr (Concepts::is_container<E>::value || Concepts::is_scalar<E>::value || Concepts::is_consumed<E>::value) {
+                return static_cast<std::size_t>(xi_expression[xi_index].size());
+            }
+            else {
+                return 0;
+            }
+        }
+
+        // append the operands of a concatenation at a specific index to an output element (all but the leftmost operand, if it was moved into the output)
+        template<bool MOVED = false, typename S, typename E> void concatenate(S& xo_out, const E& xi_expression, std::size_t xi_index) {
+            if constexpr (Concepts::is_concatenation_v<E>) {
+                concatenate<MOVED>(xo_out, xi_expression.le(), xi_index);
+                concatenate(xo_out, xi_expression.re(), xi_index);
+            }
+            else if constexpr (!MOVED) {
+                xo_out.append(xi_expression[xi_index]);
+            }
+        }
+
+        // leftmost operand of a concatenation
+        template<typename E> constexpr const auto& leftmost(const E& xi_expression) noexcept {
+            if constexpr (Concepts::is_concatenation_v<E>) {
+                return leftmost(xi_expression.le());
+            } else {
+                return xi_expression;
+            }
+        }
+
+        // leftmost operand of an accumulation
+        template<typename E> constexpr const auto& accumulated(const E& xi_expression) noexcept {
+            if constexpr (Concepts::is_accumulation_v<E>) {
+                return accumulated(xi_expression.le());
+            } else {
+                return xi_expression;
+            }
+        }
+
+        // apply the operands of an accumulation at a specific index to an output element (all but its leftmost operand)
+        template<typename S, typename E> void accumulate(S&, const E&, std::size_t) noexcept {}
+        template<typename S, typename L, typename B, typename R> void accumulate(S& xo_out, const BinaryExpression<L, B, R>& xi_expression, std::size_t xi_index) {
+            if constexpr (Concepts::is_accumulation<BinaryExpression<L, B, R>>::value) {
+                accumulate(xo_out, xi_expression.le(), xi_index);
+                B::assign(xo_out, xi_expression.re()[xi_index]);
+            }
+        }
+
+        // assign a concatenation at a specific index into an element, reusing its capacity (or the element moved out of a consumed leftmost operand,
+        // which is appended to as is if it is the element itself)
+        template<typename S, typename E> void assign_concatenation(S& xo_out, const E& xi_expression, std::size_t xi_index) {
+            const std::size_t len{ concatenated_length(xi_expression, xi_index) };
+            if constexpr (Concepts::is_consumed<std::decay_t<decltype(leftmost(xi_expression))>>::value) {
+                auto&& consumed{ leftmost(xi_expression)[xi_index] };
+                if (std::addressof(consumed) != std::addressof(xo_out)) {
+                    xo_out = std::move(consumed);
+                }
+                if (xo_out.capacity() < len) {
+                    xo_out.reserve(len);
+                }
+                concatenate<true>(xo_out, xi_expression, xi_index);
+            } else {
+                xo_out.clear();
+                if (xo_out.capacity() < len) {
+                    xo_out.reserve(len);
+                }
+                concatenate(xo_out, xi_expression, xi_index);
+            }
+        }
+
+        /**
+        * \brief an expression invoking a user callable on the elements of several operands (at the same index)
+        *
+        * @param {F,     in} callable
+        * @param {Exprs, in} operands
+        **/
+        template<typename F, typename... Exprs>
+        class MapExpression : public ExpressionOperators<MapExpression<F, Exprs...>> {
+
+            // aliases
+            public:
+                // expression value type
+                using value_type = typename std::decay<std::invoke_result_t<const F&, decltype(std::declval<const typename std::remove_reference<Exprs>::type&>()[0])...>>::type;
+
+            // properties
+            private:
+                F                    m_function;
+                std::tuple<Exprs...> m_operands;
+
+            // constructors
+            public:
+                // prohibit empty constructor
+                MapExpression() = delete;
+
+                // element wise constructor
+                MapExpression(F f, Exprs... e) : m_function(std::move(f)), m_operands(std::forward<Exprs>(e)...) {
+                    assert(std::apply([len = size()](const auto&... operands) { return (matching_size(len, operands.size()) && ...); }, m_operands));
+                }
+
+                // expression is cheap to copy (leaves are referenced)
+                MapExpression(const MapExpression&)                 = default;
+                MapExpression& operator =(const MapExpression&)     = default;
+                MapExpression(MapExpression&&) noexcept             = default;
+                MapExpression& operator =(MapExpression&&) noexcept = default;
+
+            // getters
+            public:
+
+                // callable and operands
+                const F&                    f()        const noexcept { return m_function; }
+                const std::tuple<Exprs...>& operands() const noexcept { return m_operands; }
+
+                // user callables are evaluated element by element
+                static constexpr bool is_vectorizable = false;
+
+                // amount of elements (operands are of equal size, or broadcast)
+                std::size_t size() const {
+                    return std::apply([](const auto&... operands) { return std::min<std::size_t>({ unbounded, static_cast<std::size_t>(operands.size())... }); }, m_operands);
+                }
+                static constexpr std::size_t extent = [] {
+                    std::size_t out{ unbounded };
+                    ((out = common_extent(out, Concepts::extent_v<Exprs>)), ...);
+                    return out;
+                }();
+                static_assert((matching_extent(extent, Concepts::extent_v<Exprs>) && ...), "MapExpression: operands are of different static extent.");
+
+                // aliasing with destination
+                static constexpr bool is_elementwise = (std::decay_t<Exprs>::is_elementwise && ...);
+                Alias alias(const Region& xi_destination) const {
+                    return std::apply([&xi_destination](const auto&... operands) {
+                        Alias out{ Alias::none };
+                        ((out = combine(out, operands.alias(xi_destination))), ...);
+                        return out;
+                    }, m_operands);
+                }
+
+                // does evaluation keep state?
+                static constexpr bool is_stateful = (Concepts::is_stateful_v<Exprs> || ...);
+
+                // does expression read a segmented collection?
+                static constexpr bool is_segmented = (Concepts::is_segmented_v<Exprs> || ...);
+
+                // get a cursor starting at a specific index
+                auto cursor(std::size_t index) const {
+                    return std::apply([this, index](const auto&... operands) {
+                        return ApplyCursor([this](const auto&... c) -> decltype(auto) { return std::invoke(m_function, *c...); }, detail::cursor(operands, index)...);
+                    }, m_operands);
+                }
+
+                // prepare evaluation of an index range
+                void prepare(std::size_t xi_first, std::size_t xi_last) const {
+                    std::apply([xi_first, xi_last](const auto&... operands) { (detail::prepare(operands, xi_first, xi_last), ...); }, m_operands);
+                }
+
+                // [] overload to get expression at a specific index
+                decltype(auto) operator [](std::size_t index) const {
+                    return std::apply([this, index](const auto&... operands) -> decltype(auto) { return std::invoke(m_function, operands[index]...); }, m_operands);
+                }
+        };
+
+        /**
+        * \brief an expression which remembers the last element of its operand, so an operand used by
+        *        several parents is evaluated once per index.
+        *
+        * @param {Expr, in} operand
+        *
+        * \remarks the remembered element makes the expression stateful, so it is evaluated by a single thread.
+        *          packets are not remembered, since a repeated (inlined) packet evaluation is folded by the compiler.
+        *          under tiled evaluation, operands which can not be evaluated in packets are materialized once per tile.
+        **/
+        template<typename Expr>
+        class CacheExpression : public ExpressionOperators<CacheExpression<Expr>> {
+
+            // aliases
+            public:
+                // expression value type
+                using value_type = typename std::decay_t<Expr>::value_type;
+
+            // properties
+            private:
+                Expr                               m_expr;
+                mutable std::optional<value_type>  m_value;
+                mutable std::size_t                m_index{ unbounded };
+                mutable std::vector<value_type>    m_tile;
+                mutable std::size_t                m_tile_first{};
+
+                // is operand materialized per tile? (expensive operands which are not evaluated in packets)
+                static constexpr bool is_tiled = !std::decay_t<Expr>::is_vectorizable && !std::is_same_v<value_type, bool>;
+
+            // constructors
+            public:
+                // prohibit empty constructor
+                CacheExpression() = delete;
+
+                // element wise constructor
+                explicit CacheExpression(Expr e) : m_expr(std::forward<Expr>(e)) {}
+
+                // a copy remembers its elements separately (expressions sharing a cache refer to it)
+                CacheExpression(const CacheExpression&)                 = default;
+                CacheExpression& operator =(const CacheExpression&)     = default;
+                CacheExpression(CacheExpression&&) noexcept             = default;
+                CacheExpression& operator =(CacheExpression&&) noexcept = default;
+
+            // getters
+            public:
+
+                // operand
+                auto e() const -> const typename std::remove_reference<Expr>::type& { return m_expr; }
+
+                // amount of elements
+                std::size_t size() const { return e().size(); }
+                static constexpr std::size_t extent = Concepts::extent_v<Expr>;
+
+                // aliasing with destination
+                static constexpr bool is_elementwise = std::decay_t<Expr>::is_elementwise;
+                Alias alias(const Region& xi_destination) const { return e().alias(xi_destination); }
+
+                // evaluation keeps the last element
+                static constexpr bool is_stateful = true;
+
+                // can expression be evaluated in packets?
+                static constexpr bool is_vectorizable = std::decay_t<Expr>::is_vectorizable;
+
+                // prepare evaluation of an index range (materialize it, or discard remembered elements if it is empty)
+                void prepare(std::size_t xi_first, std::size_t xi_last) const {
+                    if (xi_first >= xi_last) {
+                        m_value.reset();
+                        m_tile.clear();
+                        detail::prepare(e(), xi_first, xi_last);
+                        return;
+                    }
+
+                    if constexpr (is_tiled) {
+                        // a tile shared by several parents is materialized once
+                        if ((m_tile_first == xi_first) && (m_tile.size() == xi_last - xi_first)) {
+                            return;
+                        }
+
+                        detail::prepare(e(), xi_first, xi_last);
+                        m_tile.clear();
+                        m_tile_first = xi_first;
+                        for (std::size_t i{ xi_first }; i < xi_last; ++i) {
+                            m_tile.emplace_back(e()[i]);
+                        }
+                    } else {
+                        detail::prepare(e(), xi_first, xi_last);
+                    }
+                }
+
+                // [] overload to get expression at a specific index (operand is evaluated only if index is neither in tile nor the last index)
+                const value_type& operator [](std::size_t index) const {
+                    if constexpr (is_tiled) {
+                        if (index - m_tile_first < m_tile.size()) {
+                            return m_tile[index - m_tile_first];
+                        }
+                    }
+
+                    if (!m_value || (m_index != index)) {
+                        m_value.emplace(e()[index]);
+                        m_index = index;
+                    }
+                    return *m_value;
+                }
+
+                // get expression packet (SIMD register) starting at a specific index
+                auto packet(std::size_t index) const {
+                    return e().packet(index);
+                }
+        };
+
+        /**
+        * \brief an expression materialized (on construction) into an owned buffer, which is then read as a leaf.
+        *
+        * @param {T, in} element type
+        **/
+        template<typename T>
+        class EvalExpression : public ExpressionOperators<EvalExpression<T>> {
+
+            // aliases
+            public:
+                using value_type = T;
+
+            // properties
+            private:
+                std::vector<T> m_values;
+
+            // constructors
+            public:
+                // prohibit empty constructor
+                EvalExpression() = delete;
+
+                // evaluate an expression (with a bounded amount of elements)
+                template<typename E> explicit EvalExpression(const E& xi_expression) : m_values(xi_expression.size()) {
+                    assert(xi_expression.size() != unbounded);
+                    Lazy::Container<std::vector<T>> values(m_values);
+                    values = xi_expression;
+                }
+
+                // a copy duplicates the materialized elements
+                EvalExpression(const EvalExpression&)                 = default;
+                EvalExpression& operator =(const EvalExpression&)     = default;
+                EvalExpression(EvalExpression&&) noexcept             = default;
+                EvalExpression& operator =(EvalExpression&&) noexcept = default;
+
+            // getters
+            public:
+
+                // amount of elements
+                std::size_t size() const { return m_values.size(); }
+
+                // an owned buffer never aliases a destination
+                static constexpr bool is_elementwise = true;
+                constexpr Alias alias(const Region&) const noexcept { return Alias::none; }
+
+                // prepare evaluation of an index range (prefetch the following range)
+                void prepare(std::size_t xi_first, std::size_t xi_last) const noexcept {
+                    if constexpr (Concepts::has_data_v<std::vector<T>>) {
+                        const std::size_t len{ m_values.size() };
+                        detail::prefetch(m_values.data() + std::min(xi_last, len), m_values.data() + std::min(2 * xi_last - std::min(xi_first, xi_last), len));
+                    }
+                }
+
+                // [] overload to get materialized element at a specific index
+                typename std::vector<T>::const_reference operator [](std::size_t index) const { return m_values[index]; }
+
+                // can expression be evaluated in packets?
+                static constexpr bool is_vectorizable = Simd::enabled && std::is_arithmetic_v<T> && Concepts::has_data_v<std::vector<T>>;
+
+                // get materialized packet starting at a specific index
+                Simd::Packet<T> packet(std::size_t index) const {
+                    return Simd::Packet<T>::load(m_values.data() + index);
+                }
+        };
+
+        /**
+        * \brief a collection whose elements are moved from as they are read (see 'Lazy::consume')
+        *
+        * @param {COLLECTION, in} wrapped collection type
+        *
+        * \remarks rvalue elements are reused by the rvalue 'apply' overloads (i.e. - a string is appended to in place),
+        *          and a concatenation whose leftmost operand is consumed is built in the element moved out of it.
+        **/
+        template<typename COLLECTION>
+        class ConsumeExpression : public ExpressionOperators<ConsumeExpression<COLLECTION>> {
+
+            // aliases
+            public:
+                using value_type = typename Container<COLLECTION>::value_type;
+
+            // properties
+            private:
+                Container<COLLECTION>& m_container;
+
+            // constructors
+            public:
+                // prohibit empty constructor
+                ConsumeExpression() = delete;
+
+                // consume a container
+                explicit constexpr ConsumeExpression(Container<COLLECTION>& xi_container) noexcept : m_container(xi_container) {}
+
+            // getters
+            public:
+
+                // amount of elements (and compile time amount of elements)
+                constexpr std::size_t size() const { return static_cast<std::size_t>(m_container.size()); }
+                static constexpr std::size_t extent = Container<COLLECTION>::extent;
+
+                // aliasing with destination (of the consumed container)
+                static constexpr bool is_elementwise = Container<COLLECTION>::is_elementwise;
+                Alias alias(const Region& xi_destination) const noexcept { return m_container.alias(xi_destination); }
+
+                // prepare evaluation of an index range
+                constexpr void prepare(std::size_t xi_first, std::size_t xi_last) const { m_container.prepare(xi_first, xi_last); }
+
+                // [] overload to move element at a specific index
+                constexpr value_type&& operator [](std::size_t index) const { return std::move(m_container[index]); }
+
+                // can expression be evaluated in packets? (arithmetic elements are copied)
+                static constexpr bool is_vectorizable = Container<COLLECTION>::is_vectorizable;
+
+                // get packet starting at a specific index
+                Simd::Packet<value_type> packet(std::size_t index) const { return m_container.packet(index); }
+
+                // is consumed collection traversed by its iterators?
+                static constexpr bool is_segmented = Container<COLLECTION>::is_segmented;
+
+                // get a (moving) cursor starting at a specific index
+                auto cursor(std::size_t index) const {
+                    if constexpr (is_segmented || Concepts::has_data_v<const COLLECTION>) {
+                        return std::make_move_iterator(m_container.cursor(index));
+                    } else {
+                        return IndexCursor<ConsumeExpression>(*this, index);
+                    }
+                }
+        };
+
+        /**
+        * \brief a binary expression
+        *
+        * @param {LeftExpr,  in} left side of expression
+        * @param {BinaryOp,  in} binary operation
+        * @param {RightExpr, in} right side of expression
+        **/
+        template<typename LeftExpr, typename BinaryOp, typename RightExpr>
+        class BinaryExpression : public ExpressionOperators<BinaryExpression<LeftExpr, BinaryOp, RightExpr>> {
+
+            // aliases
+            public:
+                // expression value type
+                using value_type = typename std::decay<decltype(BinaryOp::apply(std::declval<const typename std::remove_reference<LeftExpr>::type&>()[0],
+                                                                                std::declval<const typename std::remove_reference<RightExpr>::type&>()[0]))>::type;
+
+            // properties
+            private:
+                LeftExpr  m_left;
+                RightExpr m_right;
+
+            // constructors
+            public:
+                // prohibit empty constructor
+                BinaryExpression() = delete;
+
+                // element wise constructor
+                constexpr BinaryExpression(LeftExpr l, RightExpr r) : m_left(std::forward<LeftExpr>(l)), m_right(std::forward<RightExpr>(r)) {
+                    assert(matching_size(m_left.size(), m_right.size()));
+                }
+
+                // expression is cheap to copy (leaves are referenced)
+                BinaryExpression(const BinaryExpression&)                 = default;
+                BinaryExpression& operator =(const BinaryExpression&)     = default;
+                BinaryExpression(BinaryExpression&&) noexcept             = default;
+                BinaryExpression& operator =(BinaryExpression&&) noexcept = default;
+
+            // getters
+            public:
+
+                // expression left hand side (const access always reads through a const reference, so leaves are never copied)
+                constexpr auto le()       -> typename std::add_lvalue_reference<LeftExpr>::type      { return m_left; }
+                constexpr auto le() const -> const typename std::remove_reference<LeftExpr>::type&  { return m_left; }
+
+                // expression right hand side (const access always reads through a const reference, so leaves are never copied)
+                constexpr auto re()       -> typename std::add_lvalue_reference<RightExpr>::type     { return m_right; }
+                constexpr auto re() const -> const typename std::remove_reference<RightExpr>::type& { return m_right; }
+
+                // amount of elements (operands are of equal size, or broadcast)
+                constexpr std::size_t size() const { return std::min<std::size_t>(le().size(), re().size()); }
+
+                // compile time amount of elements (static if any operand is of static extent)
+                static constexpr std::size_t extent = common_extent(Concepts::extent_v<LeftExpr>, Concepts::extent_v<RightExpr>);
+                static_assert(matching_extent(Concepts::extent_v<LeftExpr>, Concepts::extent_v<RightExpr>), "BinaryExpression: operands are of different static extent.");
+
+                // aliasing with destination
+                static constexpr bool is_elementwise = std::decay_t<LeftExpr>::is_elementwise && std::decay_t<RightExpr>::is_elementwise;
+                Alias alias(const Region& xi_destination) const { return combine(le().alias(xi_destination), re().alias(xi_destination)); }
+
+                // does evaluation keep state?
+                static constexpr bool is_stateful = Concepts::is_stateful_v<LeftExpr> || Concepts::is_stateful_v<RightExpr>;
+
+                // does expression read a segmented collection?
+                static constexpr bool is_segmented = Concepts::is_segmented_v<LeftExpr> || Concepts::is_segmented_v<RightExpr>;
+
+                // get a cursor starting at a specific index (concatenations are read by index, so each output is still reserved once)
+                auto cursor(std::size_t index) const {
+                    if constexpr (Concepts::is_concatenation_v<BinaryExpression>) {
+                        return IndexCursor<BinaryExpression>(*this, index);
+                    } else {
+                        return ApplyCursor([](const auto& l, const auto& r) -> decltype(auto) { return BinaryOp::apply(*l, *r); }, detail::cursor(le(), index), detail::cursor(re(), index));
+                    }
+                }
+
+                // prepare evaluation of an index range
+                constexpr void prepare(std::size_t xi_first, std::size_t xi_last) const {
+                    detail::prepare(le(), xi_first, xi_last);
+                    detail::prepare(re(), xi_first, xi_last);
+                }
+
+                // can expression be evaluated in packets?
+                // (operands of different arithmetic element types are converted into the element type of the operation)
+                static constexpr bool is_vectorizable = std::conjunction_v<Concepts::has_packet_of<LeftExpr, operation_value_t<BinaryOp>>, Concepts::has_packet_of<RightExpr, operation_value_t<BinaryOp>>,
+                                                                           Concepts::has_packet_apply<BinaryOp, operation_value_t<BinaryOp>>>;
+
+                /**
+                * \brief [] overload to get expression at a specific index
+                *
+                * \remarks leaves yield 'const_reference', while nested expressions yield a temporary which
+                *          is moved into (and reused by) the rvalue 'apply' overloads, i.e. - only the first
+                *          temporary of a chain is materialized.
+                *          concatenations (i.e. - strings) reserve their final length up front, so the temporary
+                *          is allocated once.
+                **/
+                constexpr auto operator [](std::size_t index) const -> decltype(BinaryOp::apply(this->le()[index], this->re()[index])) {
+                    if constexpr (Concepts::is_concatenation_v<BinaryExpression>) {
+                        value_type out;
+                        assign_concatenation(out, *this, index);
+                        return out;
+                    }
+                    else {
+                        return BinaryOp::apply(le()[index], re()[index]);
+                    }
+                }
+
+                // get expression packet (SIMD register) starting at a specific index
+                auto packet(std::size_t index) const {
+                    return BinaryOp::apply(packet_as<operation_value_t<BinaryOp>>(le(), index), packet_as<operation_value_t<BinaryOp>>(re(), index));
+                }
+
+                // can expression be evaluated as a mask packet? (relation between vectorizable operands)
+                static constexpr bool is_maskable = std::conjunction_v<Concepts::has_packet_of<LeftExpr, operation_value_t<BinaryOp>>, Concepts::has_packet_of<RightExpr, operation_value_t<BinaryOp>>,
+                                                                       Concepts::has_packet_mask<BinaryOp, operation_value_t<BinaryOp>>>;
+
+                // get expression mask packet starting at a specific index
+                auto mask(std::size_t index) const {
+                    return BinaryOp::mask(packet_as<operation_value_t<BinaryOp>>(le(), index), packet_as<operation_value_t<BinaryOp>>(re(), index));
+                }
+        };
+
+        /**
+        * \brief an associative chain of a binary operation over several operands (i.e. - 'a + b + c + d'), evaluated as a balanced tree
+        *
+        * @param {T,        in} element type
+        * @param {BinaryOp, in} associative binary operation
+        * @param {Exprs,    in} operands
+        *
+        * \remarks a balanced tree halves the dependency chain of every element, and is built (see 'flatten') when
+        *          a chain of arithmetic elements is assigned. floating point rounding may differ from a left to right evaluation
+        *          (signed integral '+' and '*' chains are evaluated as written, since a balanced tree might overflow).
+        **/
+        template<typename T, typename BinaryOp, typename... Exprs>
+        class ChainExpression : public ExpressionOperators<ChainExpression<T, BinaryOp, Exprs...>> {
+
+            // aliases
+            public:
+                using value_type = T;
+
+            // properties
+            private:
+                std::tuple<Exprs...> m_operands;
+
+                // amount of operands
+                static constexpr std::size_t count = sizeof...(Exprs);
+
+                // operation applied as a balanced tree over operands [FIRST, LAST), reading every operand through a callable
+                template<std::size_t FIRST, std::size_t LAST, typename Tuple, typename Get> static constexpr auto balanced(const Tuple& xi_operands, const Get& xi_get) {
+                    if constexpr (LAST - FIRST == 1) {
+                        return xi_get(std::get<FIRST>(xi_operands));
+                    } else {
+                        constexpr std::size_t middle{ FIRST + (LAST - FIRST) / 2 };
+                        return BinaryOp::apply(balanced<FIRST, middle>(xi_operands, xi_get), balanced<middle, LAST>(xi_operands, xi_get));
+                    }
+                }
+
+            // constructors
+            public:
+                // prohibit empty constructor
+                ChainExpression() = delete;
+
+                // element wise constructor
+                explicit constexpr ChainExpression(Exprs... e) : m_operands(std::forward<Exprs>(e)...) {
+                    assert(std::apply([len = size()](const auto&... operands) { return (matching_size(len, operands.size()) && ...); }, m_operands));
+                }
+
+            // getters
+            public:
+
+                // expression operands
+                constexpr const std::tuple<Exprs...>& operands() const noexcept { return m_operands; }
+
+                // amount of elements (operands are of equal size, or broadcast)
+                constexpr std::size_t size() const {
+                    return std::apply([](const auto&... operands) { return std::min<std::size_t>({ unbounded, static_cast<std::size_t>(operands.size())... }); }, m_operands);
+                }
+                static constexpr std::size_t extent = [] {
+                    std::size_t out{ unbounded };
+                    ((out = common_extent(out, Concepts::extent_v<Exprs>)), ...);
+                    return out;
+                }();
+
+                // aliasing with destination
+                static constexpr bool is_elementwise = (std::decay_t<Exprs>::is_elementwise && ...);
+                Alias alias(const Region& xi_destination) const {
+                    return std::apply([&xi_destination](const auto&... operands) {
+                        Alias out{ Alias::none };
+                        ((out = combine(out, operands.alias(xi_destination))), ...);
+                        return out;
+                    }, m_operands);
+                }
+
+                // does evaluation keep state?
+                static constexpr bool is_stateful = (Concepts::is_stateful_v<Exprs> || ...);
+
+                // prepare evaluation of an index range
+                constexpr void prepare(std::size_t xi_first, std::size_t xi_last) const {
+                    std::apply([xi_first, xi_last](const auto&... operands) { (detail::prepare(operands, xi_first, xi_last), ...); }, m_operands);
+                }
+
+                // can expression be evaluated in packets?
+                static constexpr bool is_vectorizable = (Concepts::has_packet_of_v<Exprs, T> && ...) && Concepts::has_packet_apply_v<BinaryOp, T>;
+
+                // [] overload to get expression at a specific index
+                constexpr value_type operator [](std::size_t index) const {
+                    return balanced<0, count>(m_operands, [index](const auto& operand) -> decltype(auto) { return operand[index]; });
+                }
+
+                // get expression packet (SIMD register) starting at a specific index
+                auto packet(std::size_t index) const {
+                    return balanced<0, count>(m_operands, [index](const auto& operand) { return packet_as<T>(operand, index); });
+                }
+
+                // does expression read a segmented collection?
+                static constexpr bool is_segmented = (Concepts::is_segmented_v<Exprs> || ...);
+
+                // get a cursor starting at a specific index
+                auto cursor(std::size_t index) const {
+                    return std::apply([index](const auto&... operands) {
+                        return ApplyCursor([](const auto&... c) { return balanced<0, count>(std::forward_as_tuple(c...), [](const auto& x) -> decltype(auto) { return *x; }); },
+                                           detail::cursor(operands, index)...);
+                    }, m_operands);
+                }
+        };
+
+        namespace Concepts {
+            // test if a binary operation is associative (so a chain of it can be evaluated in any grouping).
+            // signed integral '+' and '*' are not, since a grouping might overflow (undefined behavior) where the written order does not.
+            template<typename>   struct is_associative                             : std::false_type {};
+            template<typename T> struct is_associative<BinaryOperations::ADD<T>>   : std::bool_constant<std::is_floating_point_v<T> || std::is_unsigned_v<T>> {};
+            template<typename T> struct is_associative<BinaryOperations::MUL<T>>   : std::bool_constant<std::is_floating_point_v<T> || std::is_unsigned_v<T>> {};
+            template<typename T> struct is_associative<BinaryOperations::LAND<T>>  : std::true_type  {};
+            template<typename T> struct is_associative<BinaryOperations::LOR<T>>   : std::true_type  {};
+            template<typename T> struct is_associative<BinaryOperations::LXOR<T>>  : std::true_type  {};
+
+            // test if an expression is a binary expression of a given operation
+            template<typename, typename>                 struct is_operation_of                                 : std::false_type {};
+            template<typename L, typename B, typename R> struct is_operation_of<BinaryExpression<L, B, R>, B> : std::true_type  {};
+
+            // test if an expression is the root of an associative chain of (at least three) arithmetic operands
+            template<typename>                           struct is_chain                            : std::false_type {};
+            template<typename L, typename B, typename R> struct is_chain<BinaryExpression<L, B, R>> : std::bool_constant<is_associative<B>::value && std::is_arithmetic_v<typename BinaryExpression<L, B, R>::value_type> &&
+                                                                                                                      (is_operation_of<std::decay_t<L>, B>::value || is_operation_of<std::decay_t<R>, B>::value)> {};
+
+            // test if an expression holds an associative chain (cached operands are not looked into, since they are shared)
+            template<typename>                           struct has_chain                                   : std::false_type {};
+            template<typename E, typename U>             struct has_chain<UnaryExpression<E, U>>          : has_chain<std::decay_t<E>> {};
+            template<typename L, typename B, typename R> struct has_chain<BinaryExpression<L, B, R>>      : std::bool_constant<is_chain<BinaryExpression<L, B, R>>::value || has_chain<std::decay_t<L>>::value || has_chain<std::decay_t<R>>::value> {};
+            template<typename C, typename T, typename E> struct has_chain<WhereExpression<C, T, E>>       : std::bool_constant<has_chain<std::decay_t<C>>::value || has_chain<std::decay_t<T>>::value || has_chain<std::decay_t<E>>::value> {};
+            template<typename F, typename... Exprs>      struct has_chain<MapExpression<F, Exprs...>>     : std::bool_constant<(has_chain<std::decay_t<Exprs>>::value || ...)> {};
+            template<typename T> constexpr bool has_chain_v = has_chain<std::decay_t<T>>::value;
+        }
+
+        /**
+        * \brief an expression whose associative chains are flattened into (balanced) chain expressions, i.e. - '((a + b) + c) + d' into 'chain(a, b, c, d)'
+        *
+        * \remarks nodes are rebuilt (held by value) while leaves and cached operands are referenced.
+        *          every evaluation flattens the expression it is given (see 'flattened'), so all of them associate a chain alike.
+        **/
+        template<typename E> constexpr const E& flatten(const E& xi_leaf) noexcept { return xi_leaf; }
+
+        // the operands of an associative chain of a given operation (as a tuple of references)
+        template<typename B, typename E> constexpr auto chain_operands(const E& xi_expression) {
+            if constexpr (Concepts::is_operation_of<E, B>::value) {
+                return std::tuple_cat(chain_operands<B>(xi_expression.le()), chain_operands<B>(xi_expression.re()));
+            } else {
+                return std::tuple<const E&>(xi_expression);
+            }
+        }
+
+        template<typename E, typename U> constexpr auto flatten(const UnaryExpression<E, U>& xi_expression) {
+            return UnaryExpression<decltype(flatten(xi_expression.e())), U>(flatten(xi_expression.e()));
+        }
+
+        template<typename L, typename B, typename R> constexpr auto flatten(const BinaryExpression<L, B, R>& xi_expression) {
+            if constexpr (Concepts::is_chain<BinaryExpression<L, B, R>>::value) {
+                return std::apply([](const auto&... operands) {
+                    return ChainExpression<typename BinaryExpression<L, B, R>::value_type, B, decltype(flatten(operands))...>(flatten(operands)...);
+                }, chain_operands<B>(xi_expression));
+            } else {
+                return BinaryExpression<decltype(flatten(xi_expression.le())), B, decltype(flatten(xi_expression.re()))>(flatten(xi_expression.le()), flatten(xi_expression.re()));
+            }
+        }
+
+        template<typename C, typename T, typename E> constexpr auto flatten(const WhereExpression<C, T, E>& xi_expression) {
+            return WhereExpression<decltype(flatten(xi_expression.ce())), decltype(flatten(xi_expression.te())), decltype(flatten(xi_expression.ee()))>(flatten(xi_expression.ce()),
+                                                                                                                                                      flatten(xi_expression.te()),
+                                                                                                                                                      flatten(xi_expression.ee()));
+        }
+
+        template<typename F, typename... Exprs> auto flatten(const MapExpression<F, Exprs...>& xi_expression) {
+            return std::apply([&xi_expression](const auto&... operands) {
+                return MapExpression<F, decltype(flatten(operands))...>(xi_expression.f(), flatten(operands)...);
+            }, xi_expression.operands());
+        }
+
+        // an expression with its associative chains flattened, or the expression itself if it holds none
+        template<typename E> constexpr decltype(auto) flattened(const E& xi_expression) {
+            if constexpr (Concepts::has_chain_v<E>) {
+                return flatten(xi_expression);
+            } else {
+                return xi_expression;
+            }
+        }
+
+        namespace Concepts {
+            // test if an expression is sparse: zero off the non zeros of (one of) its sparse leaves, i.e. - a product, quotient or bitwise conjunction of a sparse operand
+            template<typename>                           struct is_sparse                                                                 : std::false_type {};
+            template<typename T>                         struct is_sparse<Sparse<T>>                                                      : std::true_type  {};
+            template<typename E, typename T>             struct is_sparse<UnaryExpression<E, UnaryOperations::NEG<T>>>                    : is_sparse<std::decay_t<E>> {};
+            template<typename L, typename T, typename R> struct is_sparse<BinaryExpression<L, BinaryOperations::MUL<T>, R>>               : std::bool_constant<is_sparse<std::decay_t<L>>::value || is_sparse<std::decay_t<R>>::value> {};
+            template<typename L, typename T, typename R> struct is_sparse<BinaryExpression<L, BinaryOperations::LAND<T>, R>>              : std::bool_constant<is_sparse<std::decay_t<L>>::value || is_sparse<std::decay_t<R>>::value> {};
+            template<typename L, typename T, typename R> struct is_sparse<BinaryExpression<L, BinaryOperations::DIV<T>, R>>               : is_sparse<std::decay_t<L>> {};
+            template<typename T> constexpr bool is_sparse_v = is_sparse<std::decay_t<T>>::value;
+
+            // test if an expression is a sum (or difference) of a sparse operand and another operand (so it can be evaluated as both, one after another)
+            template<typename>                           struct is_sparse_sum                                                   : std::false_type { static constexpr bool subtract = false; };
+            template<typename L, typename T, typename R> struct is_sparse_sum<BinaryExpression<L, BinaryOperations::ADD<T>, R>> : std::bool_constant<(is_sparse<std::decay_t<L>>::value || is_sparse<std::decay_t<R>>::value) && std::is_arithmetic_v<T>> {
+                static constexpr bool subtract = false;
+            };
+            template<typename L, typename T, typename R> struct is_sparse_sum<BinaryExpression<L, BinaryOperations::SUB<T>, R>> : std::bool_constant<is_sparse<std::decay_t<R>>::value && std::is_arithmetic_v<T>> {
+                static constexpr bool subtract = true;
+            };
+            template<typename T> constexpr bool is_sparse_sum_v = is_sparse_sum<std::decay_t<T>>::value;
+
+            // test if an expression is piecewise constant (its leaves are run length encoded, sparse or broadcast scalars), so each run can be evaluated once
+            template<typename>                           struct has_runs                                        : std::false_type {};
+            template<typename T>                         struct has_runs<Sparse<T>>                             : std::true_type  {};
+            template<typename T>                         struct has_runs<Rle<T>>                                : std::true_type  {};
+            template<typename T>                         struct has_runs<Scalar<T>>                             : std::true_type  {};
+            template<typename E, typename U>             struct has_runs<UnaryExpression<E, U>>                 : has_runs<std::decay_t<E>> {};
+            template<typename L, typename B, typename R> struct has_runs<BinaryExpression<L, B, R>>             : std::bool_constant<has_runs<std::decay_t<L>>::value && has_runs<std::decay_t<R>>::value> {};
+            template<typename C, typename T, typename E> struct has_runs<WhereExpression<C, T, E>>              : std::bool_constant<has_runs<std::decay_t<C>>::value && has_runs<std::decay_t<T>>::value && has_runs<std::decay_t<E>>::value> {};
+            template<typename F, typename... Exprs>      struct has_runs<MapExpression<F, Exprs...>>            : std::bool_constant<(has_runs<std::decay_t<Exprs>>::value && ...)> {};
+            template<typename T, typename B, typename... Exprs> struct has_runs<ChainExpression<T, B, Exprs...>> : std::bool_constant<(has_runs<std::decay_t<Exprs>>::value && ...)> {};
+            template<typename T> constexpr bool has_runs_v = has_runs<std::decay_t<T>>::value;
+
+            // test if an expression holds a run length encoded (or sparse) leaf
+            template<typename>                           struct has_encoding                                        : std::false_type {};
+            template<typename T>                         struct has_encoding<Sparse<T>>                             : std::true_type  {};
+            template<typename T>                         struct has_encoding<Rle<T>>                                : std::true_type  {};
+            template<typename E, typename U>             struct has_encoding<UnaryExpression<E, U>>                 : has_encoding<std::decay_t<E>> {};
+            template<typename L, typename B, typename R> struct has_encoding<BinaryExpression<L, B, R>>             : std::bool_constant<has_encoding<std::decay_t<L>>::value || has_encoding<std::decay_t<R>>::value> {};
+            template<typename C, typename T, typename E> struct has_encoding<WhereExpression<C, T, E>>              : std::bool_constant<has_encoding<std::decay_t<C>>::value || has_encoding<std::decay_t<T>>::value || has_encoding<std::decay_t<E>>::value> {};
+            template<typename F, typename... Exprs>      struct has_encoding<MapExpression<F, Exprs...>>            : std::bool_constant<(has_encoding<std::decay_t<Exprs>>::value || ...)> {};
+            template<typename T, typename B, typename... Exprs> struct has_encoding<ChainExpression<T, B, Exprs...>> : std::bool_constant<(has_encoding<std::decay_t<Exprs>>::value || ...)> {};
+
+            // test if an expression is piecewise constant over runs of its encoded leaves
+            template<typename T> constexpr bool is_piecewise_v = has_runs_v<T> && has_encoding<std::decay_t<T>>::value;
+        }
+
+        /**
+        * \brief index one past the end of the run (of equal elements) of a piecewise constant expression starting at a specific index
+        **/
+        template<typename E>                                std::size_t run_end(const E& xi_leaf, std::size_t xi_index);
+        template<typename T>                                constexpr std::size_t run_end(const Scalar<T>& xi_scalar, std::size_t xi_index) noexcept;
+        template<typename E, typename U>                    std::size_t run_end(const UnaryExpression<E, U>& xi_expression, std::size_t xi_index);
+        template<typename L, typename B, typename R>        std::size_t run_end(const BinaryExpression<L, B, R>& xi_expression, std::size_t xi_index);
+        template<typename C, typename T, typename E>        std::size_t run_end(const WhereExpression<C, T, E>& xi_expression, std::size_t xi_index);
+        template<typename F, typename... Exprs>             std::size_t run_end(const MapExpression<F, Exprs...>& xi_expression, std::size_t xi_index);
+        template<typename T, typename B, typename... Exprs> std::size_t run_end(const ChainExpression<T, B, Exprs...>& xi_expression, std::size_t xi_index);
+
+        template<typename E> std::size_t run_end(const E& xi_leaf, std::size_t xi_index) {
+            return xi_leaf.run_end(xi_index);
+        }
+
+        template<typename T> constexpr std::size_t run_end(const Scalar<T>&, std::size_t) noexcept {
+            return unbounded;
+        }
+
+        template<typename E, typename U> std::size_t run_end(const UnaryExpression<E, U>& xi_expression, std::size_t xi_index) {
+            return run_end(xi_expression.e(), xi_index);
+        }
+
+        template<typename L, typename B, typename R> std::size_t run_end(const BinaryExpression<L, B, R>& xi_expression, std::size_t xi_index) {
+            return std::min(run_end(xi_expression.le(), xi_index), run_end(xi_expression.re(), xi_index));
+        }
+
+        template<typename C, typename T, typename E> std::size_t run_end(const WhereExpression<C, T, E>& xi_expression, std::size_t xi_index) {
+            return std::min({ run_end(xi_expression.ce(), xi_index), run_end(xi_expression.te(), xi_index), run_end(xi_expression.ee(), xi_index) });
+        }
+
+        template<typename F, typename... Exprs> std::size_t run_end(const MapExpression<F, Exprs...>& xi_expression, std::size_t xi_index) {
+            return std::apply([xi_index](const auto&... operands) { return std::min<std::size_t>({ unbounded, run_end(operands, xi_index)... }); }, xi_expression.operands());
+        }
+
+        template<typename T, typename B, typename... Exprs> std::size_t run_end(const ChainExpression<T, B, Exprs...>& xi_expression, std::size_t xi_index) {
+            return std::apply([xi_index](const auto&... operands) { return std::min<std::size_t>({ unbounded, run_end(operands, xi_index)... }); }, xi_expression.operands());
+        }
+
+        // the sparse leaf whose non zeros are the (only) indices a sparse expression might not be zero at
+        template<typename T> constexpr const Sparse<T>& support(const Sparse<T>& xi_sparse) noexcept {
+            return xi_sparse;
+        }
+
+        template<typename E, typename U> constexpr const auto& support(const UnaryExpression<E, U>& xi_expression) noexcept {
+            return support(xi_expression.e());
+        }
+
+        template<typename L, typename B, typename R> constexpr const auto& support(const BinaryExpression<L, B, R>& xi_expression) noexcept {
+            if constexpr (Concepts::is_sparse_v<L>) {
+                return support(xi_expression.le());
+            } else {
+                return support(xi_expression.re());
+            }
+        }
+
+        /**
+        * instrumentation of assignments (enabled by defining 'MAKELAZY_INSTRUMENTATION', otherwise an assignment is evaluated as is)
+        **/
+        namespace Instrumentation {
+#if defined(MAKELAZY_INSTRUMENTATION)
+
+            // a record of an (outermost) assignment
+            struct Record {
+                std::string   shape;            // expression shape, i.e. - '((l+l)*s)' ('l' is a leaf, 's' a broadcast scalar)
+                std::size_t   nodes;            // amount of expression nodes (leaves included)
+                const char*   assignment;       // assignment operation, i.e. - '=' or '+'
+                const char*   engine;           // evaluating engine ('sequential', 'parallel', 'tiled', 'masked', 'fused', 'incremental', 'batched', ...)
+                bool          vectorized;       // could expression be evaluated in packets?
+                std::size_t   elements;         // amount of destination elements
+                std::uint64_t nanoseconds;      // elapsed time
+                std::size_t   bytes;            // bytes read from leaves and read/written in destination
+                std::uint64_t allocations;      // allocations counted during assignment (only for heap owning elements)
+            };
+
+            // the installed sink and allocation counter
+            struct Hooks {
+                std::mutex                           m_mutex;
+                std::function<void(const Record&)>   m_sink;
+                std::function<std::uint64_t()>       m_allocations;
+                std::atomic<bool>                    m_enabled{ false };
+
+                static Hooks& instance() {
+                    static Hooks hooks;
+                    return hooks;
+                }
+
+                // nesting depth of measured assignments in the calling thread (shared by every assignment type)
+                static std::size_t& depth() noexcept {
+                    thread_local std::size_t depth{};
+                    return depth;
+                }
+            };
+
+            // the shape of an expression, along with the amount of its nodes and bytes its leaves read per index
+            struct Shape {
+                std::string m_shape;
+                std::size_t m_nodes{};
+                std::size_t m_bytes{};
+            };
+
+            template<typename E>                         void describe(const E& xi_leaf, Shape& xo_shape);
+            template<typename T>                         void describe(const Scalar<T>& xi_scalar, Shape& xo_shape);
+            template<typename E, typename U>             void describe(const UnaryExpression<E, U>& xi_expression, Shape& xo_shape);
+            template<typename L, typename B, typename R> void describe(const BinaryExpression<L, B, R>& xi_expression, Shape& xo_shape);
+            template<typename C, typename T, typename E> void describe(const WhereExpression<C, T, E>& xi_expression, Shape& xo_shape);
+            template<typename F, typename... Exprs>      void describe(const MapExpression<F, Exprs...>& xi_expression, Shape& xo_shape);
+            template<typename T, typename B, typename... Exprs> void describe(const ChainExpression<T, B, Exprs...>& xi_expression, Shape& xo_shape);
+            template<typename E>                         void describe(const CacheExpression<E>& xi_expression, Shape& xo_shape);
+            template<typename... Es>                     void describe(const std::tuple<const Es&...>& xi_expressions, Shape& xo_shape);
+
+            template<typename E> void describe(const E&, Shape& xo_shape) {
+                xo_shape.m_shape += 'l';
+                ++xo_shape.m_nodes;
+                xo_shape.m_bytes += sizeof(typename std::decay_t<E>::value_type);
+            }
+
+            template<typename T> void describe(const Scalar<T>&, Shape& xo_shape) {
+                xo_shape.m_shape += 's';
+                ++xo_shape.m_nodes;
+            }
+
+            template<typename E, typename U> void describe(const UnaryExpression<E, U>& xi_expression, Shape& xo_shape) {
+                xo_shape.m_shape += U::symbol;
+                ++xo_shape.m_nodes;
+                describe(xi_expression.e(), xo_shape);
+            }
+
+            template<typename L, typename B, typename R> void describe(const BinaryExpression<L, B, R>& xi_expression, Shape& xo_shape) {
+                xo_shape.m_shape += '(';
+                ++xo_shape.m_nodes;
+                describe(xi_expression.le(), xo_shape);
+                xo_shape.m_shape += B::symbol;
+                describe(xi_expression.re(), xo_shape);
+                xo_shape.m_shape += ')';
+            }
+
+            template<typename C, typename T, typename E> void describe(const WhereExpression<C, T, E>& xi_expression, Shape& xo_shape) {
+                xo_shape.m_shape += "where(";
+                ++xo_shape.m_nodes;
+                describe(xi_expression.ce(), xo_shape);
+                xo_shape.m_shape += ',';
+                describe(xi_expression.te(), xo_shape);
+                xo_shape.m_shape += ',';
+                describe(xi_expression.ee(), xo_shape);
+                xo_shape.m_shape += ')';
+            }
+
+            template<typename F, typename... Exprs> void describe(const MapExpression<F, Exprs...>& xi_expression, Shape& xo_shape) {
+                xo_shape.m_shape += "map(";
+                ++xo_shape.m_nodes;
+                std::apply([&xo_shape](const auto&... operands) {
+                    std::size_t i{};
+                    ((xo_shape.m_shape += (i++ > 0) ? "," : "", describe(operands, xo_shape)), ...);
+                }, xi_expression.operands());
+                xo_shape.m_shape += ')';
+            }
+
+            template<typename T, typename B, typename... Exprs> void describe(const ChainExpression<T, B, Exprs...>& xi_expression, Shape& xo_shape) {
+                xo_shape.m_shape += '(';
+                ++xo_shape.m_nodes;
+                std::apply([&xo_shape](const auto&... operands) {
+                    std::size_t i{};
+                    ((xo_shape.m_shape += (i++ > 0) ? B::symbol : "", describe(operands, xo_shape)), ...);
+                }, xi_expression.operands());
+                xo_shape.m_shape += ')';
+            }
+
+            template<typename E> void describe(const CacheExpression<E>& xi_expression, Shape& xo_shape) {
+                xo_shape.m_shape += "cache(";
+                ++xo_shape.m_nodes;
+                describe(xi_expression.e(), xo_shape);
+                xo_shape.m_shape += ')';
+            }
+
+            // expressions evaluated in a single traversal (see 'Lazy::assign_all'), i.e. - '(l+l);(l-l)'
+            template<typename... Es> void describe(const std::tuple<const Es&...>& xi_expressions, Shape& xo_shape) {
+                std::apply([&xo_shape](const auto&... expressions) {
+                    std::size_t i{};
+                    ((xo_shape.m_shape += (i++ > 0) ? ";" : "", describe(expressions, xo_shape)), ...);
+                }, xi_expressions);
+            }
+
+            /**
+            * \brief evaluate an assignment, and record it in the installed sink
+            *
+            * @param {AssignOp,      in} binary operation assigning expression element into collection element
+            * @param {V,             in} destination element type
+            * @param {xi_engine,     in} evaluating engine
+            * @param {xi_expression, in} expression
+            * @param {xi_elements,   in} amount of destination elements
+            * @param {xi_vectorized, in} could expression be evaluated in packets?
+            * @param {xi_evaluate,   in} callable evaluating the assignment
+            *
+            * \remarks only the outermost assignment of a thread is recorded (an engine might fall back on a sequential evaluation).
+            **/
+            template<typename AssignOp, typename V, typename E, typename F>
+            void measure(const char* xi_engine, const E& xi_expression, std::size_t xi_elements, bool xi_vectorized, F&& xi_evaluate) {
+                std::size_t& depth{ Hooks::depth() };
+                Hooks& hooks{ Hooks::instance() };
+                if ((depth > 0) || !hooks.m_enabled.load(std::memory_order_relaxed)) {
+                    xi_evaluate();
+                    return;
+                }
+
+                // count allocations of heap owning elements
+                std::function<std::uint64_t()> allocations;
+                if constexpr (!std::is_trivially_copyable_v<V>) {
+                    std::lock_guard<std::mutex> lock(hooks.m_mutex);
+                    allocations = hooks.m_allocations;
+                }
+
+                struct Scope {
+                    std::size_t& m_depth;
+                    explicit Scope(std::size_t& xi_depth) : m_depth(xi_depth) { ++m_depth; }
+                    ~Scope() { --m_depth; }
+                };
+
+                const std::uint64_t allocated{ allocations ? allocations() : 0 };
+                const auto start{ std::chrono::steady_clock::now() };
+                {
+                    Scope scope(depth);
+                    xi_evaluate();
+                }
+                const auto elapsed{ std::chrono::steady_clock::now() - start };
+
+                Shape shape;
+                describe(xi_expression, shape);
+                const std::size_t destination{ std::is_same_v<AssignOp, BinaryOperations::ASSIGN<V>> ? sizeof(V) : 2 * sizeof(V) };
+                const Record record{ std::move(shape.m_shape), shape.m_nodes, AssignOp::symbol, xi_engine, xi_vectorized, xi_elements,
+                                     static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+                                     xi_elements * (shape.m_bytes + destination),
+                                     allocations ? allocations() - allocated : 0 };
+
+                std::lock_guard<std::mutex> lock(hooks.m_mutex);
+                if (hooks.m_sink) {
+                    hooks.m_sink(record);
+                }
+            }
+#else
+            // instrumentation is disabled
+            template<typename AssignOp, typename V, typename E, typename F>
+            constexpr void measure(const char*, const E&, std::size_t, bool, F&& xi_evaluate) {
+                xi_evaluate();
+            }
+#endif
+        }
+
+        /**
+        * \brief a fork-join pool of worker threads, used to evaluate chunks of an index range in parallel.
+        *
+        * \remarks the calling thread participates in the evaluation, so a pool of 'n' threads holds 'n - 1' workers.
+        *          a task running on the pool which runs chunks of its own (i.e. - a parallel reduction inside a mapped callable)
+        *          evaluates them in its own thread.
+        **/
+        class ThreadPool {
+
+            // properties
+            private:
+                std::vector<std::thread>         m_workers;
+                std::mutex                       m_run;       // serialize concurrent 'run' calls
+                std::mutex                       m_mutex;
+                std::condition_variable          m_work;
+                std::condition_variable          m_done;
+                std::function<void(std::size_t)> m_task;
+                std::size_t                      m_chunks{};
+                std::atomic<std::size_t>         m_next{};
+                std::size_t                      m_generation{};
+                std::size_t                      m_finished{};
+                std::exception_ptr               m_exception;
+                bool                             m_stop{ false };
+
+            // constructors
+            public:
+
+                explicit ThreadPool(std::size_t xi_threads) {
+                    for (std::size_t i{ 1 }; i < xi_threads; ++i) {
+                        m_workers.emplace_back([this] { work(); });
+                    }
+                }
+
+                ~ThreadPool() {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_stop = true;
+                    }
+                    m_work.notify_all();
+                    for (std::thread& worker : m_workers) {
+                        worker.join();
+                    }
+                }
+
+                ThreadPool(const ThreadPool&)             = delete;
+                ThreadPool& operator =(const ThreadPool&) = delete;
+
+                // the process wide pool (one thread per hardware thread)
+                static ThreadPool& instance() {
+                    static ThreadPool pool(std::max<std::size_t>(1, std::thread::hardware_concurrency()));
+                    return pool;
+                }
+
+            // API
+            public:
+
+                // amount of threads (including caller)
+                std::size_t size() const noexcept { return m_workers.size() + 1; }
+
+                /**
+                * \brief invoke a task on every chunk in [0, xi_chunks) and wait for all of them to end
+                *
+                * @param {xi_chunks, in} amount of chunks
+                * @param {xi_task,   in} callable invoked with a chunk index
+                *
+                * \remarks the first exception thrown by a task is re-thrown in the calling thread.
+                **/
+                void run(std::size_t xi_chunks, std::function<void(std::size_t)> xi_task) {
+                    if (nested()) {
+                        for (std::size_t chunk{}; chunk < xi_chunks; ++chunk) {
+                            xi_task(chunk);
+                        }
+                        return;
+                    }
+
+                    std::lock_guard<std::mutex> guard(m_run);
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_task      = std::move(xi_task);
+                        m_chunks    = xi_chunks;
+                        m_finished  = 0;
+                        m_exception = nullptr;
+                        m_next.store(0, std::memory_order_relaxed);
+                        ++m_generation;
+                    }
+                    m_work.notify_all();
+
+                    nested() = true;
+                    drain();
+                    nested() = false;
+
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_done.wait(lock, [this] { return m_finished == m_workers.size(); });
+                    m_task = nullptr;
+                    if (m_exception) {
+                        std::rethrow_exception(m_exception);
+                    }
+                }
+
+            // internal
+            private:
+
+                // is calling thread running a task? (worker threads always are)
+                static bool& nested() noexcept {
+                    static thread_local bool running{ false };
+                    return running;
+                }
+
+                // worker loop
+                void work() {
+                    nested() = true;
+                    std::size_t generation{};
+                    for (;;) {
+                        {
+                            std::unique_lock<std::mutex> lock(m_mutex);
+                            m_work.wait(lock, [&] { return m_stop || (m_generation != generation); });
+                            if (m_stop) {
+                                return;
+                            }
+                            generation = m_generation;
+                        }
+
+                        drain();
+
+                        {
+                            std::lock_guard<std::mutex> lock(m_mutex);
+                            ++m_finished;
+                        }
+                        m_done.notify_one();
+                    }
+                }
+
+                // evaluate chunks until none is left
+                void drain() {
+                    for (std::size_t chunk{ m_next.fetch_add(1) }; chunk < m_chunks; chunk = m_next.fetch_add(1)) {
+                        try {
+                            m_task(chunk);
+                        } catch (...) {
+                            std::lock_guard<std::mutex> lock(m_mutex);
+                            if (!m_exception) {
+                                m_exception = std::current_exception();
+                            }
+                        }
+                    }
+                }
+        };
+
+        // default amount of elements below which parallel evaluation stays serial
+        constexpr std::size_t parallel_grain{ 1 << 15 };
+
+        /**
+        * \brief split an index range into chunks (at most one per pool thread) and evaluate them in parallel
+        *
+        * @param {xi_size,  in}  amount of indices
+        * @param {xi_grain, in}  amount of indices below which evaluation stays serial
+        * @param {xi_line,   in}  chunk boundaries are aligned to this amount of indices
+        * @param {xi_offset, in}  amount of indices the range starts at past an aligned boundary (see 'line_offset')
+        * @param {xi_task,   in}  callable invoked with (chunk index, first index, one past last index) of every non empty chunk
+        * @param {return,    out} amount of chunks
+        **/
+        template<typename F> std::size_t for_each_chunk(std::size_t xi_size, std::size_t xi_grain, std::size_t xi_line, std::size_t xi_offset, F&& xi_task) {
+            ThreadPool& pool{ ThreadPool::instance() };
+            const std::size_t chunks{ std::min(pool.size(), xi_size / std::max<std::size_t>(1, xi_grain)) };
+
+            if (chunks <= 1) {
+                xi_task(std::size_t{}, std::size_t{}, xi_size);
+                return 1;
+            }
+
+            const std::size_t step{ ((xi_size / chunks + xi_line - 1) / xi_line) * xi_line },
+                              offset{ xi_offset % xi_line };
+            pool.run(chunks, [&](std::size_t xi_chunk) {
+                const std::size_t first{ (xi_chunk == 0) ? 0 : std::min(xi_size, xi_chunk * step - offset) },
+                                  last{ (xi_chunk + 1 == chunks) ? xi_size : std::min(xi_size, (xi_chunk + 1) * step - offset) };
+                if (first < last) {
+                    xi_task(xi_chunk, first, last);
+                }
+            });
+            return chunks;
+        }
+
+        // amount of elements a contiguous collection starts at past a cache line boundary (zero for other collections)
+        template<typename C> std::size_t line_offset(const C& xi_collection) noexcept {
+            if constexpr (Concepts::has_data_v<const C>) {
+                using element_type = std::remove_cv_t<std::remove_pointer_t<decltype(xi_collection.data())>>;
+                return static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(xi_collection.data()) % cache_line) / sizeof(element_type);
+            } else {
+                return 0;
+            }
+        }
+    };
+
+    namespace detail {
+
+        /**
+        * \brief a window over the elements 'offset + i * step' (i < size) of a collection, which can be wrapped by 'Lazy::Container'.
+        *
+        * @param {COLLECTION, in} windowed collection
+        * @param {CONTIGUOUS, in} is step one? (contiguous windows over contiguous collections expose 'data')
+        **/
+        template<typename COLLECTION, bool CONTIGUOUS> class Window {
+
+            // aliases
+            public:
+                using value_type             = typename COLLECTION::value_type;
+                using size_type              = std::size_t;
+                using difference_type        = std::ptrdiff_t;
+                using reference              = typename COLLECTION::reference;
+                using const_reference        = typename COLLECTION::const_reference;
+                using pointer                = typename COLLECTION::pointer;
+                using const_pointer          = typename COLLECTION::const_pointer;
+                using iterator               = void;
+                using const_iterator         = void;
+                using reverse_iterator       = void;
+                using const_reverse_iterator = void;
+
+            // properties
+            private:
+                COLLECTION* m_collection;
+                std::size_t m_offset;
+                std::size_t m_size;
+                std::size_t m_step;
+
+            // constructors
+            public:
+                Window(COLLECTION& xi_collection, std::size_t xi_offset, std::size_t xi_size, std::size_t xi_step) noexcept :
+                    m_collection(&xi_collection), m_offset(xi_offset), m_size(xi_size), m_step(xi_step) {
+                    assert((xi_step == 1) || !CONTIGUOUS);
+                    assert((xi_size == 0) || (xi_offset + (xi_size - 1) * xi_step < static_cast<std::size_t>(xi_collection.size())));
+                }
+
+            // getters
+            public:
+                COLLECTION& collection() const noexcept { return *m_collection; }
+                std::size_t offset()     const noexcept { return m_offset;      }
+                std::size_t step()       const noexcept { return m_step;        }
+                std::size_t size()       const noexcept { return m_size;        }
+
+                reference       operator[] (std::size_t i)       { return (*m_collection)[m_offset + i * m_step]; }
+                const_reference operator[] (std::size_t i) const { return (*m_collection)[m_offset + i * m_step]; }
+
+                // contiguous elements
+                template<bool K = CONTIGUOUS, typename std::enable_if<K && Concepts::has_data_v<COLLECTION>>::type* = nullptr>
+                auto data() const noexcept { return m_collection->data() + m_offset; }
+
+                // elements of windowed collection
+                Region region() const noexcept {
+                    return Region{ static_cast<const void*>(m_collection), static_cast<std::ptrdiff_t>(m_offset), m_step };
+                }
+        };
+
+        // holds a window ahead of the container wrapping it (base from member)
+        template<typename W> struct WindowHolder {
+            W m_window;
+        };
+    };
+
+    /**
+    * \brief extend a container to be lazy evaluated under operator overloading.
+    *
+    * @param{COLLECTION} the collection/container to be (element wise) lazy evaluated.
+    *                    the container must include the following:
+    *                    > 'size' method (which returns the amount of elements in collection).
+    *                    > '[]' operator which allow access to an element via an index.
+    *
+    * \remarks notice that the underlying element held by the wrapped container must support the
+    *          overloaded operations.
+    **/
+    template<typename COLLECTION> struct Container {
+        // test that container upholds basic requirement
+        static_assert(detail::Concepts::can_be_wrapped<COLLECTION>, "Container<Collection>: Collection can not be wrapped.");
+
+        //
+        // aliases
+        //
+        using value_type             = typename COLLECTION::value_type;
+        using size_type              = typename COLLECTION::size_type;
+        using difference_type        = typename COLLECTION::difference_type;
+        using reference              = typename COLLECTION::reference;
+        using const_reference        = typename COLLECTION::const_reference;
+        using pointer                = typename COLLECTION::pointer;
+        using const_pointer          = typename COLLECTION::const_pointer;
+        using iterator               = typename COLLECTION::iterator;
+        using const_iterator         = typename COLLECTION::const_iterator;
+        using reverse_iterator       = typename COLLECTION::reverse_iterator;
+        using const_reverse_iterator = typename COLLECTION::const_reverse_iterator;
+
+        //
+        // constructors
+        // 
+
+        // standard constructor
+        constexpr Container(COLLECTION& xi_col) : m_container(xi_col) {}
+
+        // construct from a binary expression
+        template<typename T, typename std::enable_if<detail::Concepts::is_binary_expression_v<T>>::type* = nullptr>
+        Container(T&& xi_expression) noexcept {
+            for (std::size_t i{}; i < m_container.size(); ++i) {
+                m_container[i] = std::move(xi_expression[i]);
+            }
+        }
+
+        // assign from a (right) expression or a (broadcast) scalar
+        template<typename T, typename std::enable_if<detail::Concepts::is_expression_v<T> || std::is_convertible_v<T, value_type>>::type * = nullptr>
+        constexpr Container& operator =(T&& xi_expression) {
+            assign<detail::BinaryOperations::ASSIGN<value_type>>(detail::operand<value_type>(std::forward<T>(xi_expression)));
+            return *this;
+        }
+
+        // copy semantics (copy assignment evaluates the elements of another container)
+        Container(const Container&) = default;
+        Container& operator = (const Container& xi_other) {
+            assign<detail::BinaryOperations::ASSIGN<value_type>>(xi_other);
+            return *this;
+        }
+
+        // move semantics
+        Container(Container&&) noexcept              = default;
+        Container& operator = (Container&&) noexcept = default;
+
+        //
+        // access operator (by reference, so expression evaluation does not copy the wrapped elements)
+        //
+        constexpr reference       operator[] (size_type i)       { return m_container[i]; }
+        constexpr const_reference operator[] (size_type i) const { return m_container[i]; }
+
+        // amount of elements in wrapped collection
+        constexpr size_type size() const { return m_container.size(); }
+
+        // compile time amount of elements in wrapped collection ('dynamic_extent' unless it is known at compile time, i.e. - 'std::array')
+        static constexpr std::size_t extent = detail::Concepts::static_extent<COLLECTION>::value;
+
+        //
+        // aliasing
+        //
+
+        // wrapped collection
+        COLLECTION& collection() const noexcept { return m_container; }
+
+        // elements of wrapped collection (a window reports the elements of the collection it is over)
+        detail::Region region() const noexcept {
+            if constexpr (detail::Concepts::is_window<COLLECTION>::value) {
+                return m_container.region();
+            } else {
+                return detail::Region{ static_cast<const void*>(&m_container), 0, 1 };
+            }
+        }
+
+        // prepare evaluation of an index range (prefetch the following range ahead of the cursor, and advise a mapped collection to read it ahead)
+        constexpr void prepare(std::size_t xi_first, std::size_t xi_last) const {
+            if constexpr (detail::Concepts::has_data_v<const COLLECTION>) {
+                if (xi_first >= xi_last) {
+                    return;
+                }
+                const std::size_t len{ static_cast<std::size_t>(m_container.size()) },
+                                  first{ std::min(xi_last, len) },
+                                  last{ std::min(2 * xi_last - xi_first, len) };
+                detail::prefetch(m_container.data() + first, m_container.data() + last);
+                if constexpr (detail::Concepts::has_advise<const COLLECTION>::value) {
+                    m_container.advise(first, last);
+                }
+            }
+        }
+
+        // a container is read at the index it is evaluated at, while a window can read other elements of a collection.
+        // (distinct collections are assumed not to share storage, and an equally sized destination over the same collection which is not a window is identical)
+        static constexpr bool is_elementwise = !detail::Concepts::is_window<COLLECTION>::value;
+        detail::Alias alias(const detail::Region& xi_destination) const noexcept {
+            return detail::alias(region(), xi_destination);
+        }
+
+        //
+        // sequential (cursor) evaluation
+        //
+
+        // is wrapped collection traversed by its iterators? (non contiguous collections, i.e. - 'std::deque' or 'std::list')
+        static constexpr bool is_segmented = detail::Concepts::is_segmented_collection_v<COLLECTION>;
+
+        // get a cursor starting at a specific index (a pointer for contiguous collections, and an iterator for segmented collections)
+        auto cursor(std::size_t i) const {
+            if constexpr (detail::Concepts::has_data_v<const COLLECTION>) {
+                return m_container.data() + i;
+            } else if constexpr (is_segmented) {
+                return std::next(std::cbegin(m_container), static_cast<difference_type>(i));
+            } else {
+                return detail::IndexCursor<Container>(*this, i);
+            }
+        }
+
+        // a destination wrapper which only assigns to elements where a condition holds, i.e. - 'lazy_d.masked(lazy_a > lazy_b) += lazy_c'
+        // (condition nodes are held by value, so the wrapper can be named)
+        template<typename Cond, typename std::enable_if<detail::Concepts::is_expression_v<Cond>>::type* = nullptr>
+        Masked<COLLECTION, detail::stored_t<Cond>> masked(Cond&& xi_cond) {
+            return Masked<COLLECTION, detail::stored_t<Cond>>(*this, std::forward<Cond>(xi_cond));
+        }
+
+        //
+        // packet (SIMD) evaluation
+        //
+
+        // can container be evaluated in packets? (arithmetic elements held contiguously)
+        static constexpr bool is_vectorizable = detail::Simd::enabled && std::is_arithmetic_v<value_type> && detail::Concepts::has_data_v<COLLECTION>;
+
+        // get the packet starting at a specific index
+        detail::Simd::Packet<value_type> packet(std::size_t i) const { return detail::Simd::Packet<value_type>::load(m_container.data() + i); }
+
+        //
+        // operator overloading
+        //
+        
+#define M_OPERATOR_OVERLOAD(OP, AOP, NAME)                                                                                                                                                                                                   \
+        template<typename T, typename std::enable_if<detail::Concepts::is_expression_v<T> || std::is_convertible_v<T, value_type>>::type* = nullptr>                                                                                          \
+        constexpr Container& operator AOP (T&& xi_expression) {                                                                                                                                                                              \
+            assign<detail::BinaryOperations::NAME<value_type>>(detail::operand<value_type>(std::forward<T>(xi_expression)));                                                                                                          \
+            return *this;                                                                                                                                                                                                                    \
+        }                                                                                                                                                                                                                                    \
+        template<typename RightExpr> constexpr auto operator OP (RightExpr&& xi_expression) const&                                                                                                                                    \
+            -> detail::BinaryExpression<const Container&, detail::BinaryOperations::NAME<detail::operation_t<Container, RightExpr>>, detail::operand_t<RightExpr, value_type>> {                                                      \
+            return detail::BinaryExpression<const Container&, detail::BinaryOperations::NAME<detail::operation_t<Container, RightExpr>>, detail::operand_t<RightExpr, value_type>>(*this,                                             \
+                                                                                                                                                                    detail::operand<value_type>(std::forward<RightExpr>(xi_expression)));\
+        }                                                                                                                                                                                                                             \
+
+        M_OPERATOR_OVERLOAD(+,  +=,  ADD);
+        M_OPERATOR_OVERLOAD(-,  -=,  SUB);
+        M_OPERATOR_OVERLOAD(*,  *=,  MUL);
+        M_OPERATOR_OVERLOAD(/,  /=,  DIV);
+        M_OPERATOR_OVERLOAD(&,  &=,  LAND);
+        M_OPERATOR_OVERLOAD(|,  |=,  LOR);
+        M_OPERATOR_OVERLOAD(^,  ^=,  LXOR);
+        M_OPERATOR_OVERLOAD(<<, <<=, SHL);
+        M_OPERATOR_OVERLOAD(>>, >>=, SHR);
+
+#undef M_OPERATOR_OVERLOAD
+
+
+#define M_OPERATOR_OVERLOADING(OP, NAME)                                                                                                                                                                                              \
+        template<typename RightExpr> constexpr auto operator OP (RightExpr&& xi_expression) const&                                                                                                                                    \
+            -> detail::BinaryExpression<const Container&, detail::BinaryOperations::NAME<detail::operation_t<Container, RightExpr>>, detail::operand_t<RightExpr, value_type>> {                                                      \
+            return detail::BinaryExpression<const Container&, detail::BinaryOperations::NAME<detail::operation_t<Container, RightExpr>>, detail::operand_t<RightExpr, value_type>>(*this,                                             \
+                                                                                                                                                                    detail::operand<value_type>(std::forward<RightExpr>(xi_expression)));\
+        }
+
+        M_OPERATOR_OVERLOADING(== , EQ);
+        M_OPERATOR_OVERLOADING(!= , NEQ);
+        M_OPERATOR_OVERLOADING(< , LT);
+        M_OPERATOR_OVERLOADING(<= , LE);
+        M_OPERATOR_OVERLOADING(> , GT);
+        M_OPERATOR_OVERLOADING(>= , GE);
+        M_OPERATOR_OVERLOADING(&& , AND);
+        M_OPERATOR_OVERLOADING(|| , OR);
+
+#undef M_OPERATOR_OVERLOADING
+
+#define M_UNARY_OPERATOR_OVERLOAD(OP, NAME)                                                                  \
+        constexpr auto operator OP () const& -> detail::UnaryExpression<const Container&, NAME> {            \
+            return detail::UnaryExpression<const Container&, NAME>(*this);                                   \
+        }
+
+        M_UNARY_OPERATOR_OVERLOAD(-, detail::UnaryOperations::NEG<value_type>);
+        M_UNARY_OPERATOR_OVERLOAD(~, detail::UnaryOperations::BITNOT<value_type>);
+        M_UNARY_OPERATOR_OVERLOAD(!, detail::UnaryOperations::NOT<value_type>);
+
+#undef M_UNARY_OPERATOR_OVERLOAD
+
+        // evaluation
+        private:
+
+            // destination wrappers which evaluate expressions over (part of) the wrapped collection
+            template<typename> friend class Parallel;
+            template<typename> friend class Tiled;
+            template<typename> friend class Stream;
+            template<typename> friend class Incremental;
+            template<typename, typename> friend class Masked;
+            friend struct detail::Fusion;
+
+            /**
+            * \brief evaluate an expression into the wrapped collection, using the fastest strategy which is safe under aliasing
+            *
+            * @param {AssignOp,      in} binary operation assigning expression element into collection element
+            * @param {xi_expression, in} expression
+            *
+            * \remarks expressions which are only read at the evaluated index are evaluated in place without any runtime test.
+            *          otherwise, expressions which read the destination ahead (behind) of the evaluated index are evaluated
+            *          in place from first to last (last to first) index, and only arbitrary reads use a scratch buffer.
+            *          collections of static extent are evaluated by a loop whose trip count is known at compile time.
+            **/
+            template<typename AssignOp, typename T> constexpr void assign(const T& xi_expression) {
+                if constexpr (detail::Concepts::has_chain_v<T>) {
+                    assign<AssignOp>(detail::flatten(xi_expression));
+                } else if (detail::is_constant_evaluated()) {
+                    evaluate_assignment<AssignOp>(xi_expression);
+                } else {
+                    detail::Instrumentation::measure<AssignOp, value_type>("sequential", xi_expression, m_container.size(), is_vectorizable && std::decay_t<T>::is_vectorizable,
+                                                                           [this, &xi_expression] { evaluate_assignment<AssignOp>(xi_expression); });
+                }
+            }
+
+            // evaluate an expression into the wrapped collection (see 'assign')
+            template<typename AssignOp, typename T> constexpr void evaluate_assignment(const T& xi_expression) {
+                static_assert(detail::matching_extent(extent, detail::Concepts::extent_v<T>), "Container: expression and collection are of different static extent.");
+                assert(detail::matching_size(xi_expression.size(), m_container.size()));
+                detail::prepare(xi_expression, 0, 0);
+
+                // expressions of sparse and run length encoded leaves are evaluated according to their structure
+                if constexpr (!is_segmented && !detail::Concepts::is_segmented_v<T>) {
+                    if constexpr (detail::Concepts::is_sparse_v<T> && std::is_arithmetic_v<value_type>) {
+                        if (evaluate_sparse<AssignOp>(xi_expression)) {
+                            return;
+                        }
+                    } else if constexpr (detail::Concepts::is_sparse_sum_v<T> && std::is_arithmetic_v<value_type>) {
+                        if (evaluate_sparse_sum<AssignOp>(xi_expression)) {
+                            return;
+                        }
+                    } else if constexpr (detail::Concepts::is_piecewise_v<T>) {
+                        evaluate_runs<AssignOp>(xi_expression);
+                        return;
+                    }
+                }
+
+                if constexpr ((extent != detail::dynamic_extent) && std::decay_t<T>::is_elementwise && !detail::Concepts::is_concatenation_v<T> && !detail::Concepts::is_accumulation_v<T>) {
+                    evaluate_static<AssignOp>(xi_expression);
+                    return;
+                }
+                else if constexpr (!std::decay_t<T>::is_elementwise) {
+                    switch (xi_expression.alias(region())) {
+                        case detail::Alias::backward:
+                            for (std::size_t i{ m_container.size() }; i > 0; --i) {
+                                AssignOp::assign(m_container[i - 1], xi_expression[i - 1]);
+                            }
+                            return;
+                        case detail::Alias::unknown:
+                            evaluate_scratch<AssignOp>(xi_expression);
+                            return;
+                        default:
+                            break;
+                    }
+                }
+
+                evaluate<AssignOp>(xi_expression, 0, m_container.size());
+            }
+
+            /**
+            * \brief evaluate a sparse expression (see 'Lazy::Sparse') over its non zeros
+            *
+            * @param {AssignOp,      in}  binary operation assigning expression element into collection element
+            * @param {xi_expression, in}  sparse expression
+            * @param {return,        out} false if expression can not be evaluated over its non zeros (nothing is evaluated)
+            **/
+            template<typename AssignOp, typename T> bool evaluate_sparse(const T& xi_expression) {
+                const auto& sparse{ detail::support(xi_expression) };
+                if (!(sparse.background() == value_type{}) || (xi_expression.alias(region()) != detail::Alias::none)) {
+                    return false;
+                }
+
+                if constexpr (std::is_same_v<AssignOp, detail::BinaryOperations::ASSIGN<value_type>>) {
+                    for (std::size_t i{}, len{ m_container.size() }; i < len; ++i) {
+                        m_container[i] = value_type{};
+                    }
+                } else if constexpr (!std::is_same_v<AssignOp, detail::BinaryOperations::ADD<value_type>>  && !std::is_same_v<AssignOp, detail::BinaryOperations::SUB<value_type>> &&
+                                     !std::is_same_v<AssignOp, detail::BinaryOperations::LOR<value_type>>  && !std::is_same_v<AssignOp, detail::BinaryOperations::LXOR<value_type>>) {
+                    return false;
+                }
+
+                for (const std::size_t i : sparse.indices()) {
+                    AssignOp::assign(m_container[i], xi_expression[i]);
+                }
+                return true;
+            }
+
+            // evaluate a sum (or difference) of a sparse operand and another operand, as the other operand and then the sparse operand over its non zeros
+            template<typename AssignOp, typename T> bool evaluate_sparse_sum(const T& xi_expression) {
+                using add = detail::BinaryOperations::ADD<value_type>;
+                using sub = detail::BinaryOperations::SUB<value_type>;
+                constexpr bool sparse_left{ detail::Concepts::is_sparse_v<decltype(xi_expression.le())> },
+                               subtract{ detail::Concepts::is_sparse_sum<std::decay_t<T>>::subtract };
+                const auto& sparse{ [&xi_expression]() -> const auto& { if constexpr (sparse_left) { return xi_expression.le(); } else { return xi_expression.re(); } }() };
+                const auto& other{ [&xi_expression]() -> const auto& { if constexpr (sparse_left) { return xi_expression.re(); } else { return xi_expression.le(); } }() };
+
+                if constexpr (std::is_same_v<AssignOp, detail::BinaryOperations::ASSIGN<value_type>> || std::is_same_v<AssignOp, add> || std::is_same_v<AssignOp, sub>) {
+                    if (!(detail::support(sparse).background() == value_type{}) || (sparse.alias(region()) != detail::Alias::none)) {
+                        return false;
+                    }
+
+                    assign<AssignOp>(other);
+                    if constexpr (subtract == std::is_same_v<AssignOp, sub>) {
+                        evaluate_sparse<add>(sparse);
+                    } else {
+                        evaluate_sparse<sub>(sparse);
+                    }
+                    return true;
+                }
+                return false;
+            }
+
+            // evaluate a piecewise constant expression once per run
+            template<typename AssignOp, typename T> void evaluate_runs(const T& xi_expression) {
+                for (std::size_t i{}, len{ m_container.size() }; i < len;) {
+                    const std::size_t last{ std::min(detail::run_end(xi_expression, i), len) };
+                    const typename std::decay_t<T>::value_type value(xi_expression[i]);
+                    for (; i < last; ++i) {
+                        AssignOp::assign(m_container[i], value);
+                    }
+                }
+            }
+
+            /**
+            * \brief evaluate an expression into the wrapped collection of static extent
+            *
+            * @param {AssignOp,      in} binary operation assigning expression element into collection element
+            * @param {xi_expression, in} expression
+            *
+            * \remarks packets tile the extent exactly and the remaining elements are unrolled, so there is no runtime tail.
+            *          extents (or amounts of packets) up to 'unroll_limit' are fully unrolled. compile time evaluation is element wise.
+            **/
+            template<typename AssignOp, typename T> constexpr void evaluate_static(const T& xi_expression) {
+                constexpr std::size_t len{ extent };
+
+                if constexpr (is_vectorizable && detail::Concepts::has_packet_of_v<T, value_type>) {
+                    if (!detail::is_constant_evaluated()) {
+                        using packet_type = detail::Simd::Packet<value_type>;
+                        constexpr std::size_t packets{ len / packet_type::size },
+                                              tail{ packets * packet_type::size };
+                        value_type* data{ m_container.data() };
+
+                        if constexpr (packets <= detail::unroll_limit) {
+                            detail::unroll<packets>([&](auto k) {
+                                constexpr std::size_t i{ decltype(k)::value * packet_type::size };
+                                AssignOp::apply(packet_type::load(data + i), detail::packet_as<value_type>(xi_expression, i)).store(data + i);
+                            });
+                        } else {
+                            for (std::size_t i{}; i < tail; i += packet_type::size) {
+                                AssignOp::apply(packet_type::load(data + i), detail::packet_as<value_type>(xi_expression, i)).store(data + i);
+                            }
+                        }
+                        detail::unroll<len - tail>([&](auto k) { AssignOp::assign(m_container[tail + k], xi_expression[tail + k]); });
+                        return;
+                    }
+                }
+
+                if constexpr (len <= detail::unroll_limit) {
+                    detail::unroll<len>([&](auto k) { AssignOp::assign(m_container[k], xi_expression[k]); });
+                } else {
+                    for (std::size_t i{}; i < len; ++i) {
+                        AssignOp::assign(m_container[i], xi_expression[i]);
+                    }
+                }
+            }
+
+            // evaluate an expression into a scratch buffer, and then (move) assign it into the wrapped collection
+            template<typename AssignOp, typename T> void evaluate_scratch(const T& xi_expression) {
+                const std::size_t len{ m_container.size() };
+                std::vector<value_type> scratch;
+                scratch.reserve(len);
+                for (std::size_t i{}; i < len; ++i) {
+                    scratch.emplace_back(xi_expression[i]);
+                }
+                for (std::size_t i{}; i < len; ++i) {
+                    AssignOp::assign(m_container[i], std::move(scratch[i]));
+                }
+            }
+
+            /**
+            * \brief evaluate an expression into a range of the wrapped collection
+            *
+            * @param {AssignOp,      in} binary operation assigning expression element into collection element
+            * @param {xi_expression, in} expression
+            * @param {xi_first,      in} index of first element to evaluate
+            * @param {xi_last,       in} index one past the last element to evaluate
+            *
+            * \remarks vectorizable expressions are evaluated packet by packet, leaving a scalar tail.
+            *          concatenations which do not read the destination are appended directly into the (reserved)
+            *          destination elements, reusing their capacity and allocator, and accumulations which do not read the
+            *          destination are built in the destination elements (assigned their leftmost operand, then added to).
+            *          expressions over segmented collections (and segmented destinations) are evaluated through cursors.
+            **/
+            template<typename AssignOp, typename T> void evaluate(const T& xi_expression, std::size_t xi_first, std::size_t xi_last) {
+                std::size_t i{ xi_first };
+
+                if constexpr (detail::Concepts::is_concatenation_v<T> && std::is_same_v<typename std::decay_t<T>::value_type, value_type> &&
+                              (std::is_same_v<AssignOp, detail::BinaryOperations::ASSIGN<value_type>> || std::is_same_v<AssignOp, detail::BinaryOperations::ADD<value_type>>)) {
+                    if (xi_expression.alias(region()) == detail::Alias::none) {
+                        for (; i < xi_last; ++i) {
+                            value_type& out{ m_container[i] };
+                            if constexpr (std::is_same_v<AssignOp, detail::BinaryOperations::ASSIGN<value_type>>) {
+                                detail::assign_concatenation(out, xi_expression, i);
+                            } else {
+                                const std::size_t len{ static_cast<std::size_t>(out.size()) + detail::concatenated_length(xi_expression, i) };
+                                if (out.capacity() < len) {
+                                    out.reserve(len);
+                                }
+                                detail::concatenate(out, xi_expression, i);
+                            }
+                        }
+                        return;
+                    }
+                }
+
+                if constexpr (detail::Concepts::is_accumulation_v<T> && std::is_same_v<typename std::decay_t<T>::value_type, value_type> &&
+                              (std::is_same_v<AssignOp, detail::BinaryOperations::ASSIGN<value_type>> || std::is_same_v<AssignOp, detail::BinaryOperations::ADD<value_type>>)) {
+                    if (xi_expression.alias(region()) == detail::Alias::none) {
+                        for (; i < xi_last; ++i) {
+                            value_type& out{ m_container[i] };
+                            if constexpr (std::is_same_v<AssignOp, detail::BinaryOperations::ASSIGN<value_type>>) {
+                                out = detail::accumulated(xi_expression)[i];
+                            } else {
+                                out += detail::accumulated(xi_expression)[i];
+                            }
+                            detail::accumulate(out, xi_expression, i);
+                        }
+                        return;
+                    }
+                }
+
+                if constexpr (is_vectorizable && detail::Concepts::has_packet_of_v<T, value_type>) {
+                    using packet_type = detail::Simd::Packet<value_type>;
+                    value_type* data{ m_container.data() };
+
+                    for (; i + packet_type::size <= xi_last; i += packet_type::size) {
+                        AssignOp::apply(packet_type::load(data + i), detail::packet_as<value_type>(xi_expression, i)).store(data + i);
+                    }
+                }
+
+                if constexpr (is_segmented) {
+                    auto in{ detail::cursor(xi_expression, i) };
+                    for (auto out{ std::next(std::begin(m_container), static_cast<difference_type>(i)) }; i < xi_last; ++i, ++in, ++out) {
+                        AssignOp::assign(*out, *in);
+                    }
+                } else if constexpr (detail::Concepts::is_segmented_v<T>) {
+                    for (auto in{ detail::cursor(xi_expression, i) }; i < xi_last; ++i, ++in) {
+                        AssignOp::assign(m_container[i], *in);
+                    }
+                } else {
+                    for (; i < xi_last; ++i) {
+                        AssignOp::assign(m_container[i], xi_expression[i]);
+                    }
+                }
+            }
+
+        // properties
+        private:
+            COLLECTION& m_container;
+    };
+    /**
+    * \brief a lazy container over a window of a collection (see 'Lazy::slice', 'Lazy::stride' and 'Lazy::shift'),
+    *        usable as an expression operand and as an assignment target without copying the windowed elements.
+    *
+    * @param {COLLECTION, in} windowed collection
+    * @param {CONTIGUOUS, in} is step one?
+    *
+    * \remarks a view wraps a window it holds, so a copied (or moved) view wraps its own copy of the window,
+    *          and an expression built over a temporary view holds the view (rather than a reference to it).
+    **/
+    template<typename COLLECTION, bool CONTIGUOUS>
+    class View : private detail::WindowHolder<detail::Window<COLLECTION, CONTIGUOUS>>, public Container<detail::Window<COLLECTION, CONTIGUOUS>> {
+        using window_type = detail::Window<COLLECTION, CONTIGUOUS>;
+
+        public:
+            //
+            // constructors
+            //
+
+            View(COLLECTION& xi_collection, std::size_t xi_offset, std::size_t xi_size, std::size_t xi_step) :
+                detail::WindowHolder<window_type>{ window_type(xi_collection, xi_offset, xi_size, xi_step) },
+                Container<window_type>(this->m_window) {}
+
+            View(const View& xi_view) :
+                detail::WindowHolder<window_type>{ xi_view.m_window },
+                Container<window_type>(this->m_window) {}
+
+            View& operator =(const View&) = delete;
+
+            // assignment (and compound assignment) of expressions
+            using Container<window_type>::operator =;
+
+            using value_type = typename Container<window_type>::value_type;
+
+            //
+            // operator overloading (a temporary view is held by value)
+            //
+
+#define M_OPERATOR_OVERLOAD(OP, NAME)                                                                                                                                     \
+            template<typename RightExpr> constexpr auto operator OP (RightExpr&& xi_expression) const&                                                                    \
+                -> detail::BinaryExpression<const View&, detail::BinaryOperations::NAME<detail::operation_t<View, RightExpr>>, detail::operand_t<RightExpr, value_type>> { \
+                return detail::BinaryExpression<const View&, detail::BinaryOperations::NAME<detail::operation_t<View, RightExpr>>, detail::operand_t<RightExpr, value_type>>(\
+                    *this, detail::operand<value_type>(std::forward<RightExpr>(xi_expression)));                                                                          \
+            }                                                                                                                                                             \
+            template<typename RightExpr> constexpr auto operator OP (RightExpr&& xi_expression) &&                                                                        \
+                -> detail::BinaryExpression<View, detail::BinaryOperations::NAME<detail::operation_t<View, RightExpr>>, detail::operand_t<RightExpr, value_type>> {       \
+                return detail::BinaryExpression<View, detail::BinaryOperations::NAME<detail::operation_t<View, RightExpr>>, detail::operand_t<RightExpr, value_type>>(   \
+                    std::move(*this), detail::operand<value_type>(std::forward<RightExpr>(xi_expression)));                                                               \
+            }
+
+            M_OPERATOR_OVERLOAD(+,  ADD);
+            M_OPERATOR_OVERLOAD(-,  SUB);
+            M_OPERATOR_OVERLOAD(*,  MUL);
+            M_OPERATOR_OVERLOAD(/,  DIV);
+            M_OPERATOR_OVERLOAD(&,  LAND);
+            M_OPERATOR_OVERLOAD(|,  LOR);
+            M_OPERATOR_OVERLOAD(^,  LXOR);
+            M_OPERATOR_OVERLOAD(<<, SHL);
+            M_OPERATOR_OVERLOAD(>>, SHR);
+            M_OPERATOR_OVERLOAD(==, EQ);
+            M_OPERATOR_OVERLOAD(!=, NEQ);
+            M_OPERATOR_OVERLOAD(<,  LT);
+            M_OPERATOR_OVERLOAD(<=, LE);
+            M_OPERATOR_OVERLOAD(>,  GT);
+            M_OPERATOR_OVERLOAD(>=, GE);
+            M_OPERATOR_OVERLOAD(&&, AND);
+            M_OPERATOR_OVERLOAD(||, OR);
+
+#undef M_OPERATOR_OVERLOAD
+
+#define M_UNARY_OPERATOR_OVERLOAD(OP, NAME)                                                                                     \
+            constexpr auto operator OP () const& -> detail::UnaryExpression<const View&, NAME> {                                  \
+                return detail::UnaryExpression<const View&, NAME>(*this);                                                         \
+            }                                                                                                                     \
+            constexpr auto operator OP () && -> detail::UnaryExpression<View, NAME> {                                             \
+                return detail::UnaryExpression<View, NAME>(std::move(*this));                                                     \
+            }
+
+            M_UNARY_OPERATOR_OVERLOAD(-, detail::UnaryOperations::NEG<value_type>);
+            M_UNARY_OPERATOR_OVERLOAD(~, detail::UnaryOperations::BITNOT<value_type>);
+            M_UNARY_OPERATOR_OVERLOAD(!, detail::UnaryOperations::NOT<value_type>);
+
+#undef M_UNARY_OPERATOR_OVERLOAD
+    };
+
+    namespace detail {
+
+        // window of a container as (collection, offset, step), composing windows of views
+        template<typename C> auto window_of(Container<C>& xi_container) {
+            if constexpr (Concepts::is_window<C>::value) {
+                const C& window{ xi_container.collection() };
+                return std::make_tuple(&window.collection(), window.offset(), window.step());
+            } else {
+                return std::make_tuple(&xi_container.collection(), std::size_t{}, std::size_t{ 1 });
+            }
+        }
+
+        // collection windowed by a container (the collection a view is over)
+        template<typename C>          struct windowed                 { using type = C; };
+        template<typename C, bool K>  struct windowed<Window<C, K>>   { using type = C; };
+        template<typename C> using windowed_t = typename windowed<C>::type;
+
+        // views of a container (a slice of a strided view is strided)
+        template<typename C> using slice_t  = View<windowed_t<C>, !Concepts::is_window<C>::value || std::is_same_v<C, Window<windowed_t<C>, true>>>;
+        template<typename C> using stride_t = View<windowed_t<C>, false>;
+    };
+
+    /**
+    * \brief a view over the elements [first, last) of a lazy container, i.e. - 'Lazy::slice(lazy_d, 0, 4) = Lazy::slice(lazy_a, 4, 8)'
+    *
+    * @param {xi_container, in}  lazy container (or view)
+    * @param {xi_first,     in}  index of first element
+    * @param {xi_last,      in}  index one past the last element
+    * @param {return,       out} view
+    **/
+    template<typename C> detail::slice_t<C> slice(Container<C>& xi_container, std::size_t xi_first, std::size_t xi_last) {
+        assert((xi_first <= xi_last) && (xi_last <= static_cast<std::size_t>(xi_container.size())));
+        const auto [collection, offset, step] = detail::window_of(xi_container);
+        return { *collection, offset + xi_first * step, xi_last - xi_first, step };
+    }
+
+    /**
+    * \brief a view over every 'step' element of a lazy container, i.e. - 'Lazy::stride(lazy_xyz, 3) *= 2.0f' (scales the 'x' of interleaved coordinates)
+    *
+    * @param {xi_container, in}  lazy container (or view)
+    * @param {xi_step,      in}  distance between elements (at least one)
+    * @param {return,       out} view
+    **/
+    template<typename C> detail::stride_t<C> stride(Container<C>& xi_container, std::size_t xi_step) {
+        assert(xi_step > 0);
+        const auto [collection, offset, step] = detail::window_of(xi_container);
+        const std::size_t len{ static_cast<std::size_t>(xi_container.size()) };
+        return { *collection, offset, (len + xi_step - 1) / xi_step, step * xi_step };
+    }
+
+    /**
+    * \brief a view over a lazy container whose element 'i' is element 'i + k' of the container (its 'len - |k|' overlapping elements),
+    *        i.e. - 'Lazy::shift(lazy_d, -1) = Lazy::shift(lazy_a, 1) - Lazy::shift(lazy_a, -1)'
+    *
+    * @param {xi_container, in}  lazy container (or view)
+    * @param {xi_k,         in}  shift
+    * @param {return,       out} view
+    **/
+    template<typename C> detail::slice_t<C> shift(Container<C>& xi_container, std::ptrdiff_t xi_k) {
+        const std::size_t len{ static_cast<std::size_t>(xi_container.size()) },
+                          k{ static_cast<std::size_t>(xi_k < 0 ? -xi_k : xi_k) };
+        assert(k <= len);
+        return (xi_k < 0) ? slice(xi_container, 0, len - k) : slice(xi_container, k, len);
+    }
+
+    // views of (temporary) views, i.e. - 'Lazy::stride(Lazy::shift(lazy_a, 1), 2)' (a view refers to the windowed collection, never to the view it was built from)
+    template<typename C> detail::slice_t<C>  slice(Container<C>&& xi_view, std::size_t xi_first, std::size_t xi_last) { return slice(xi_view, xi_first, xi_last); }
+    template<typename C> detail::stride_t<C> stride(Container<C>&& xi_view, std::size_t xi_step)                      { return stride(xi_view, xi_step);        }
+    template<typename C> detail::slice_t<C>  shift(Container<C>&& xi_view, std::ptrdiff_t xi_k)                       { return shift(xi_view, xi_k);            }
+
+    /**
+    * \brief an expression invoking a callable on the elements of several operands, i.e. - 'Lazy::map([](float x, float y) { return std::max(x, y); }, lazy_a, lazy_b)'
+    *
+    * @param {xi_function, in} callable (invoked with the element of every operand at a given index)
+    * @param {xi_operands, in} operands (expressions, or scalars which are broadcast)
+    * @param {return,      out} map expression
+    **/
+    template<typename F, typename... Exprs> auto map(F&& xi_function, Exprs&&... xi_operands) -> detail::MapExpression<std::decay_t<F>, detail::operand_t<Exprs, std::decay_t<Exprs>>...> {
+        return detail::MapExpression<std::decay_t<F>, detail::operand_t<Exprs, std::decay_t<Exprs>>...>(std::forward<F>(xi_function),
+                                                                                                           detail::operand<std::decay_t<Exprs>>(std::forward<Exprs>(xi_operands))...);
+    }
+
+    /**
+    * \brief select (per index) between two operands according to a condition, i.e. - 'lazy_d = Lazy::where(lazy_a > lazy_b, lazy_a, 0.0f)'
+    *
+    * @param {xi_cond, in}  condition expression
+    * @param {xi_then, in}  operand selected where condition holds (expression or scalar)
+    * @param {xi_else, in}  operand selected where condition does not hold (expression or scalar)
+    * @param {return,  out} conditional expression
+    *
+    * \remarks the value type of the expression is the value type of the first operand which is an expression.
+    **/
+    template<typename C, typename T, typename E, typename std::enable_if<detail::Concepts::is_expression_v<C>>::type* = nullptr,
+             typename V = typename std::conditional_t<detail::Concepts::is_expression_v<T>, detail::operand_value<T>, detail::operand_value<E>>::type>
+    auto where(C&& xi_cond, T&& xi_then, E&& xi_else) -> detail::WhereExpression<detail::stored_t<C>, detail::operand_t<T, V>, detail::operand_t<E, V>> {
+        return detail::WhereExpression<detail::stored_t<C>, detail::operand_t<T, V>, detail::operand_t<E, V>>(std::forward<C>(xi_cond),
+                                                                                                              detail::operand<V>(std::forward<T>(xi_then)),
+                                                                                                              detail::operand<V>(std::forward<E>(xi_else)));
+    }
+
+    /**
+    * \brief evaluate each element of an expression once, however many parents read it, i.e. - 'auto t = Lazy::cache(lazy_a * lazy_b); lazy_d = t + t * lazy_c'
+    *
+    * @param {xi_expression, in}  expression
+    * @param {return,        out} caching expression (holding nodes by value and leaves by reference)
+    **/
+    template<typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    auto cache(E&& xi_expression) -> detail::CacheExpression<detail::stored_t<E>> {
+        return detail::CacheExpression<detail::stored_t<E>>(std::forward<E>(xi_expression));
+    }
+
+    /**
+    * \brief materialize an expression into an owned buffer, which is then read as a leaf by other expressions
+    *
+    * @param {xi_expression, in}  expression (with a bounded amount of elements)
+    * @param {return,        out} materialized expression
+    **/
+    template<typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    auto eval(const E& xi_expression) -> detail::EvalExpression<typename std::decay_t<E>::value_type> {
+        static_assert(detail::Concepts::is_bounded_v<E>, "Lazy::eval: an expression of broadcast scalars only has no amount of elements.");
+        return detail::EvalExpression<typename std::decay_t<E>::value_type>(xi_expression);
+    }
+
+    /**
+    * \brief read the elements of a container by moving them, for containers which are dead after an expression, i.e. - 'lazy_d = Lazy::consume(lazy_a) + lazy_b'
+    *
+    * @param {xi_container, in}  container (its elements are left in a valid but unspecified state once read)
+    * @param {return,       out} consuming expression
+    **/
+    template<typename COLLECTION> constexpr detail::ConsumeExpression<COLLECTION> consume(Container<COLLECTION>& xi_container) noexcept {
+        return detail::ConsumeExpression<COLLECTION>(xi_container);
+    }
+
+    /**
+    * \brief a sparse collection (sorted indices of the elements which differ from a background value, and their values),
+    *        i.e. - 'Lazy::Sparse<float> s(n); s.set(7, 1.0f); lazy_d += s * lazy_a' (only the non zeros of 's' are evaluated)
+    *
+    * @param {T, in} element type
+    *
+    * \remarks sparse expressions (products, quotients and bitwise conjunctions of a sparse operand) over a zero background are assigned by
+    *          clearing the destination and evaluating the non zeros, and only the non zeros are evaluated by compound addition (or subtraction).
+    *          a sum of a sparse and another operand is evaluated as the other operand, and then the sparse operand.
+    *          since non zeros are the only elements evaluated, 'x * 0' is taken to be zero for every 'x' (even infinite or 'NaN').
+    **/
+    template<typename T> class Sparse : public detail::ExpressionOperators<Sparse<T>> {
+
+        // aliases
+        public:
+            using value_type = T;
+
+        // properties
+        private:
+            std::size_t              m_size;
+            T                        m_background;
+            std::vector<std::size_t> m_indices;
+            std::vector<T>           m_values;
+
+        // constructors
+        public:
+            // an amount of background elements
+            explicit Sparse(std::size_t xi_size, T xi_background = T{}) : m_size(xi_size), m_background(std::move(xi_background)) {}
+
+        // setters
+        public:
+
+            // set element at a specific index (set in increasing index order to append)
+            void set(std::size_t xi_index, T xi_value) {
+                assert(xi_index < m_size);
+                const auto it{ std::lower_bound(m_indices.begin(), m_indices.end(), xi_index) };
+                const auto at{ it - m_indices.begin() };
+                if ((it != m_indices.end()) && (*it == xi_index)) {
+                    m_values[static_cast<std::size_t>(at)] = std::move(xi_value);
+                } else {
+                    m_indices.insert(it, xi_index);
+                    m_values.insert(m_values.begin() + at, std::move(xi_value));
+                }
+            }
+
+        // getters
+        public:
+
+            // non zeros (indices and values) and background value
+            const std::vector<std::size_t>& indices()  const noexcept { return m_indices; }
+            const std::vector<T>&           values()   const noexcept { return m_values; }
+            const T&                        background() const noexcept { return m_background; }
+
+            // amount of elements
+            std::size_t size() const noexcept { return m_size; }
+
+            // a sparse collection owns its elements, so it never aliases a destination
+            static constexpr bool is_elementwise = true;
+            constexpr detail::Alias alias(const detail::Region&) const noexcept { return detail::Alias::none; }
+
+            // [] overload to get element at a specific index
+            const T& operator [](std::size_t index) const {
+                const auto it{ std::lower_bound(m_indices.begin(), m_indices.end(), index) };
+                return ((it != m_indices.end()) && (*it == index)) ? m_values[static_cast<std::size_t>(it - m_indices.begin())] : m_background;
+            }
+
+            // elements are not contiguous
+            static constexpr bool is_vectorizable = false;
+
+            // index one past the end of the run starting at a specific index (a non zero is a run of its own)
+            std::size_t run_end(std::size_t xi_index) const {
+                const auto it{ std::lower_bound(m_indices.begin(), m_indices.end(), xi_index) };
+                if (it == m_indices.end()) {
+                    return m_size;
+                }
+                return (*it == xi_index) ? xi_index + 1 : *it;
+            }
+    };
+
+    /**
+    * \brief a run length encoded collection, i.e. - 'Lazy::Rle<std::string> r(s); lazy_d = r + lazy_suffix' (each run of 'r' is evaluated once)
+    *
+    * @param {T, in} element type
+    *
+    * \remarks expressions whose leaves are run length encoded, sparse or broadcast scalars are evaluated once per run (of all their leaves),
+    *          and the value is assigned over the run.
+    **/
+    template<typename T> class Rle : public detail::ExpressionOperators<Rle<T>> {
+
+        // aliases
+        public:
+            using value_type = T;
+
+        // properties
+        private:
+            std::vector<T>           m_values;
+            std::vector<std::size_t> m_ends;       // index one past the end of every run
+
+        // constructors
+        public:
+            Rle() = default;
+
+            // encode a collection
+            template<typename COLLECTION, typename std::enable_if<!std::is_same_v<std::decay_t<COLLECTION>, Rle>>::type* = nullptr>
+            explicit Rle(const COLLECTION& xi_collection) {
+                for (const auto& value : xi_collection) {
+                    push_back(value, 1);
+                }
+            }
+
+        // setters
+        public:
+
+            // append a run of elements (merged with the last run if it is of the same value)
+            void push_back(const T& xi_value, std::size_t xi_count) {
+                if (xi_count == 0) {
+                    return;
+                }
+                if (!m_values.empty() && (m_values.back() == xi_value)) {
+                    m_ends.back() += xi_count;
+                } else {
+                    m_values.push_back(xi_value);
+                    m_ends.push_back(size() + xi_count);
+                }
+            }
+
+        // getters
+        public:
+
+            // amount of elements (and of runs)
+            std::size_t size() const noexcept { return m_ends.empty() ? 0 : m_ends.back(); }
+            std::size_t runs() const noexcept { return m_values.size(); }
+
+            // a run length encoded collection owns its elements, so it never aliases a destination
+            static constexpr bool is_elementwise = true;
+            constexpr detail::Alias alias(const detail::Region&) const noexcept { return detail::Alias::none; }
+
+            // [] overload to get element at a specific index
+            const T& operator [](std::size_t index) const {
+                return m_values[static_cast<std::size_t>(std::upper_bound(m_ends.begin(), m_ends.end(), index) - m_ends.begin())];
+            }
+
+            // elements are not contiguous
+            static constexpr bool is_vectorizable = false;
+
+            // index one past the end of the run starting at a specific index
+            std::size_t run_end(std::size_t xi_index) const {
+                return *std::upper_bound(m_ends.begin(), m_ends.end(), xi_index);
+            }
+    };
+
+    /**
+    * \brief execution policy of reductions: evaluate chunks of the index range using 'detail::ThreadPool'.
+    *
+    * \remarks ranges shorter than the grain size are evaluated serially.
+    **/
+    struct ParallelPolicy {
+        std::size_t grain{ detail::parallel_grain };
+    };
+    constexpr ParallelPolicy parallel{};
+
+    /**
+    * reductions kernels
+    **/
+    namespace detail {
+
+        /**
+        * \brief reduce an index range of an expression using several independent accumulators
+        *
+        * @param {xi_expression, in}  expression
+        * @param {xi_first,      in}  index of first element
+        * @param {xi_last,       in}  index one past the last element (xi_first < xi_last)
+        * @param {xi_operation,  in}  associative and commutative reduction operation
+        * @param {return,        out} reduction
+        *
+        * \remarks arithmetic elements are accumulated in several (packets of) accumulators to break the dependency
+        *          chain and are then combined, so the order of operations differs from a sequential fold.
+        **/
+        template<typename E, typename Op> auto reduce_unordered(const E& xi_expression, std::size_t xi_first, std::size_t xi_last, Op xi_operation) {
+            using value_type = typename std::decay_t<E>::value_type;
+            constexpr std::size_t accumulators{ 4 };
+            std::size_t i{ xi_first };
+            prepare(xi_expression, 0, 0);
+
+            if constexpr (Concepts::is_segmented_v<E>) {
+                auto c{ cursor(xi_expression, xi_first) };
+                value_type out(*c);
+                for (++i, ++c; i < xi_last; ++i, ++c) {
+                    out = xi_operation(std::move(out), *c);
+                }
+                return out;
+            } else if constexpr (std::is_arithmetic_v<value_type> && std::decay_t<E>::is_vectorizable) {
+                using packet_type = Simd::Packet<value_type>;
+                constexpr std::size_t step{ accumulators * packet_type::size };
+
+                if (xi_last - xi_first >= step) {
+                    packet_type acc[accumulators];
+                    for (std::size_t k{}; k < accumulators; ++k) {
+                        acc[k] = xi_expression.packet(i + k * packet_type::size);
+                    }
+                    for (i += step; i + step <= xi_last; i += step) {
+                        for (std::size_t k{}; k < accumulators; ++k) {
+                            const packet_type p{ xi_expression.packet(i + k * packet_type::size) };
+                            for (std::size_t j{}; j < packet_type::size; ++j) {
+                                acc[k].v[j] = xi_operation(acc[k].v[j], p.v[j]);
+                            }
+                        }
+                    }
+
+                    value_type out{ acc[0].v[0] };
+                    for (std::size_t j{ 1 }; j < packet_type::size; ++j) {
+                        out = xi_operation(out, acc[0].v[j]);
+                    }
+                    for (std::size_t k{ 1 }; k < accumulators; ++k) {
+                        for (std::size_t j{}; j < packet_type::size; ++j) {
+                            out = xi_operation(out, acc[k].v[j]);
+                        }
+                    }
+                    for (; i < xi_last; ++i) {
+                        out = xi_operation(out, xi_expression[i]);
+                    }
+                    return out;
+                }
+            } else if constexpr (std::is_arithmetic_v<value_type>) {
+                if (xi_last - xi_first >= accumulators) {
+                    value_type acc[accumulators];
+                    for (std::size_t k{}; k < accumulators; ++k) {
+                        acc[k] = xi_expression[i + k];
+                    }
+                    for (i += accumulators; i + accumulators <= xi_last; i += accumulators) {
+                        for (std::size_t k{}; k < accumulators; ++k) {
+                            acc[k] = xi_operation(acc[k], xi_expression[i + k]);
+                        }
+                    }
+
+                    value_type out{ xi_operation(xi_operation(acc[0], acc[1]), xi_operation(acc[2], acc[3])) };
+                    for (; i < xi_last; ++i) {
+                        out = xi_operation(out, xi_expression[i]);
+                    }
+                    return out;
+                }
+            }
+
+            value_type out(xi_expression[i]);
+            for (++i; i < xi_last; ++i) {
+                out = xi_operation(std::move(out), xi_expression[i]);
+            }
+            return out;
+        }
+
+        /**
+        * \brief reduce a non empty expression in parallel chunks, combining the chunks in order
+        *
+        * @param {xi_policy,     in}  parallel policy
+        * @param {xi_expression, in}  expression
+        * @param {xi_kernel,     in}  callable reducing an index range, invoked with (first, last)
+        * @param {xi_combine,    in}  callable combining (accumulated, chunk) results
+        * @param {return,        out} reduction
+        **/
+        template<typename E, typename K, typename C> auto reduce_parallel(ParallelPolicy xi_policy, const E& xi_expression, K&& xi_kernel, C&& xi_combine) {
+            using result_type = std::decay_t<decltype(xi_kernel(std::size_t{}, std::size_t{}))>;
+            std::vector<std::optional<result_type>> partial(ThreadPool::instance().size());
+            prepare(xi_expression, 0, 0);
+
+            const std::size_t grain{ Concepts::is_stateful_v<E> ? unbounded : xi_policy.grain };
+            const std::size_t chunks{ for_each_chunk(xi_expression.size(), grain, 1, 0, [&](std::size_t xi_chunk, std::size_t xi_first, std::size_t xi_last) {
+                partial[xi_chunk].emplace(xi_kernel(xi_first, xi_last));
+            }) };
+
+            std::optional<result_type> out;
+            for (std::size_t i{}; i < chunks; ++i) {
+                if (partial[i]) {
+                    out = out ? xi_combine(std::move(*out), std::move(*partial[i])) : std::move(*partial[i]);
+                }
+            }
+            return std::move(*out);
+        }
+    };
+
+    /**
+    * \brief fold the elements of an expression, in index order, without writing them anywhere
+    *
+    * @param {xi_expression, in}  expression
+    * @param {xi_init,       in}  initial value
+    * @param {xi_operation,  in}  binary callable, invoked with (accumulated value, element)
+    * @param {return,        out} reduction
+    **/
+    template<typename E, typename T, typename Op, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    T reduce(const E& xi_expression, T xi_init, Op xi_operation) {
+        static_assert(detail::Concepts::is_bounded_v<E>, "Lazy::reduce: an expression of broadcast scalars only has no amount of elements.");
+        if constexpr (detail::Concepts::has_chain_v<E>) {
+            return reduce(detail::flatten(xi_expression), std::move(xi_init), xi_operation);
+        }
+        detail::prepare(xi_expression, 0, 0);
+        if constexpr (detail::Concepts::is_segmented_v<E>) {
+            auto c{ detail::cursor(xi_expression, 0) };
+            for (std::size_t i{}, len{ xi_expression.size() }; i < len; ++i, ++c) {
+                xi_init = xi_operation(std::move(xi_init), *c);
+            }
+        } else {
+            for (std::size_t i{}, len{ xi_expression.size() }; i < len; ++i) {
+                xi_init = xi_operation(std::move(xi_init), xi_expression[i]);
+            }
+        }
+        return xi_init;
+    }
+
+    /**
+    * \brief parallel fold of the elements of an expression (operation must be associative, chunks are combined in index order)
+    *
+    * @param {xi_policy,     in}  parallel policy
+    * @param {xi_expression, in}  expression
+    * @param {xi_init,       in}  initial value (identity of operation, used once per chunk)
+    * @param {xi_operation,  in}  binary callable, invoked with (accumulated value, element) and (accumulated value, chunk)
+    * @param {return,        out} reduction
+    **/
+    template<typename E, typename T, typename Op, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    T reduce(ParallelPolicy xi_policy, const E& xi_expression, T xi_init, Op xi_operation) {
+        static_assert(detail::Concepts::is_bounded_v<E>, "Lazy::reduce: an expression of broadcast scalars only has no amount of elements.");
+        if constexpr (detail::Concepts::has_chain_v<E>) {
+            return reduce(xi_policy, detail::flatten(xi_expression), std::move(xi_init), xi_operation);
+        }
+        if (xi_expression.size() == 0) {
+            return xi_init;
+        }
+        return detail::reduce_parallel(xi_policy, xi_expression,
+                                       [&](std::size_t xi_first, std::size_t xi_last) {
+                                           T out(xi_init);
+                                           for (std::size_t i{ xi_first }; i < xi_last; ++i) {
+                                               out = xi_operation(std::move(out), xi_expression[i]);
+                                           }
+                                           return out;
+                                       }, xi_operation);
+    }
+
+    /**
+    * \brief sum of the elements of an expression (value initialized for an empty expression)
+    *
+    * \remarks arithmetic sums use several (SIMD) accumulators, so floating point rounding may differ from a sequential sum.
+    **/
+    template<typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    auto sum(const E& xi_expression) -> typename std::decay_t<E>::value_type {
+        static_assert(detail::Concepts::is_bounded_v<E>, "Lazy::sum: an expression of broadcast scalars only has no amount of elements.");
+        if constexpr (detail::Concepts::has_chain_v<E>) {
+            return sum(detail::flatten(xi_expression));
+        }
+        if (xi_expression.size() == 0) {
+            return typename std::decay_t<E>::value_type{};
+        }
+        return detail::reduce_unordered(xi_expression, 0, xi_expression.size(), [](auto&& a, const auto& b) { return std::forward<decltype(a)>(a) + b; });
+    }
+
+    template<typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    auto sum(ParallelPolicy xi_policy, const E& xi_expression) -> typename std::decay_t<E>::value_type {
+        static_assert(detail::Concepts::is_bounded_v<E>, "Lazy::sum: an expression of broadcast scalars only has no amount of elements.");
+        if constexpr (detail::Concepts::has_chain_v<E>) {
+            return sum(xi_policy, detail::flatten(xi_expression));
+        }
+        if (xi_expression.size() == 0) {
+            return typename std::decay_t<E>::value_type{};
+        }
+        const auto add = [](auto&& a, const auto& b) { return std::forward<decltype(a)>(a) + b; };
+        return detail::reduce_parallel(xi_policy, xi_expression, [&](std::size_t xi_first, std::size_t xi_last) { return detail::reduce_unordered(xi_expression, xi_first, xi_last, add); }, add);
+    }
+
+    /**
+    * \brief smallest/largest element of an expression (throws 'std::invalid_argument' if expression is empty)
+    **/
+    template<typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    auto min(const E& xi_expression) -> typename std::decay_t<E>::value_type {
+        static_assert(detail::Concepts::is_bounded_v<E>, "Lazy::min: an expression of broadcast scalars only has no amount of elements.");
+        if constexpr (detail::Concepts::has_chain_v<E>) {
+            return min(detail::flatten(xi_expression));
+        }
+        if (xi_expression.size() == 0) {
+            throw std::invalid_argument("Lazy::min: empty expression.");
+        }
+        return detail::reduce_unordered(xi_expression, 0, xi_expression.size(), [](auto&& a, const auto& b) { return (b < a) ? b : std::forward<decltype(a)>(a); });
+    }
+
+    template<typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    auto min(ParallelPolicy xi_policy, const E& xi_expression) -> typename std::decay_t<E>::value_type {
+        static_assert(detail::Concepts::is_bounded_v<E>, "Lazy::min: an expression of broadcast scalars only has no amount of elements.");
+        if constexpr (detail::Concepts::has_chain_v<E>) {
+            return min(xi_policy, detail::flatten(xi_expression));
+        }
+        if (xi_expression.size() == 0) {
+            throw std::invalid_argument("Lazy::min: empty expression.");
+        }
+        const auto smaller = [](auto&& a, const auto& b) { return (b < a) ? b : std::forward<decltype(a)>(a); };
+        return detail::reduce_parallel(xi_policy, xi_expression, [&](std::size_t xi_first, std::size_t xi_last) { return detail::reduce_unordered(xi_expression, xi_first, xi_last, smaller); }, smaller);
+    }
+
+    template<typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    auto max(const E& xi_expression) -> typename std::decay_t<E>::value_type {
+        static_assert(detail::Concepts::is_bounded_v<E>, "Lazy::max: an expression of broadcast scalars only has no amount of elements.");
+        if constexpr (detail::Concepts::has_chain_v<E>) {
+            return max(detail::flatten(xi_expression));
+        }
+        if (xi_expression.size() == 0) {
+            throw std::invalid_argument("Lazy::max: empty expression.");
+        }
+        return detail::reduce_unordered(xi_expression, 0, xi_expression.size(), [](auto&& a, const auto& b) { return (a < b) ? b : std::forward<decltype(a)>(a); });
+    }
+
+    template<typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    auto max(ParallelPolicy xi_policy, const E& xi_expression) -> typename std::decay_t<E>::value_type {
+        static_assert(detail::Concepts::is_bounded_v<E>, "Lazy::max: an expression of broadcast scalars only has no amount of elements.");
+        if constexpr (detail::Concepts::has_chain_v<E>) {
+            return max(xi_policy, detail::flatten(xi_expression));
+        }
+        if (xi_expression.size() == 0) {
+            throw std::invalid_argument("Lazy::max: empty expression.");
+        }
+        const auto larger = [](auto&& a, const auto& b) { return (a < b) ? b : std::forward<decltype(a)>(a); };
+        return detail::reduce_parallel(xi_policy, xi_expression, [&](std::size_t xi_first, std::size_t xi_last) { return detail::reduce_unordered(xi_expression, xi_first, xi_last, larger); }, larger);
+    }
+
+    /**
+    * \brief amount of elements of an expression which are (convertible to) true, i.e. - 'Lazy::count(lazy_a > lazy_b)'
+    **/
+    template<typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    std::size_t count(const E& xi_expression) {
+        return reduce(xi_expression, std::size_t{}, [](std::size_t a, const auto& b) { return a + (static_cast<bool>(b) ? 1 : 0); });
+    }
+
+    template<typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    std::size_t count(ParallelPolicy xi_policy, const E& xi_expression) {
+        static_assert(detail::Concepts::is_bounded_v<E>, "Lazy::count: an expression of broadcast scalars only has no amount of elements.");
+        if constexpr (detail::Concepts::has_chain_v<E>) {
+            return count(xi_policy, detail::flatten(xi_expression));
+        }
+        if (xi_expression.size() == 0) {
+            return 0;
+        }
+        return detail::reduce_parallel(xi_policy, xi_expression,
+                                       [&](std::size_t xi_first, std::size_t xi_last) {
+                                           std::size_t out{};
+                                           for (std::size_t i{ xi_first }; i < xi_last; ++i) {
+                                               out += static_cast<bool>(xi_expression[i]) ? 1 : 0;
+                                           }
+                                           return out;
+                                       }, std::plus<std::size_t>{});
+    }
+
+    /**
+    * \brief test if any/all elements of an expression are (convertible to) true (evaluation stops at the first decisive element)
+    **/
+    template<typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    bool any(const E& xi_expression) {
+        static_assert(detail::Concepts::is_bounded_v<E>, "Lazy::any: an expression of broadcast scalars only has no amount of elements.");
+        if constexpr (detail::Concepts::has_chain_v<E>) {
+            return any(detail::flatten(xi_expression));
+        }
+        detail::prepare(xi_expression, 0, 0);
+        auto c{ detail::cursor(xi_expression, 0) };
+        for (std::size_t i{}, len{ xi_expression.size() }; i < len; ++i, ++c) {
+            if (static_cast<bool>(*c)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    bool all(const E& xi_expression) {
+        static_assert(detail::Concepts::is_bounded_v<E>, "Lazy::all: an expression of broadcast scalars only has no amount of elements.");
+        if constexpr (detail::Concepts::has_chain_v<E>) {
+            return all(detail::flatten(xi_expression));
+        }
+        detail::prepare(xi_expression, 0, 0);
+        auto c{ detail::cursor(xi_expression, 0) };
+        for (std::size_t i{}, len{ xi_expression.size() }; i < len; ++i, ++c) {
+            if (!static_cast<bool>(*c)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+    * scalar (left hand side) operator overloading, i.e. - '2.0f * lazy_a'
+    **/
+#define M_SCALAR_OPERATOR_OVERLOAD(OP, NAME)                                                                                                                                             \
+    template<typename S, typename E, typename std::enable_if<detail::Concepts::is_scalar_operand_v<S, E>>::type* = nullptr>                                                              \
+    constexpr auto operator OP (S&& xi_scalar, E&& xi_expression) {                                                                                                                      \
+        using value_type = typename std::decay_t<E>::value_type;                                                                                                                         \
+        return detail::BinaryExpression<detail::Scalar<value_type>, detail::BinaryOperations::NAME<value_type>, detail::stored_t<E>>(                                                   \
+            detail::Scalar<value_type>(static_cast<value_type>(std::forward<S>(xi_scalar))), std::forward<E>(xi_expression));                                                           \
+    }
+
+    M_SCALAR_OPERATOR_OVERLOAD(+,  ADD);
+    M_SCALAR_OPERATOR_OVERLOAD(-,  SUB);
+    M_SCALAR_OPERATOR_OVERLOAD(*,  MUL);
+    M_SCALAR_OPERATOR_OVERLOAD(/,  DIV);
+    M_SCALAR_OPERATOR_OVERLOAD(&,  LAND);
+    M_SCALAR_OPERATOR_OVERLOAD(|,  LOR);
+    M_SCALAR_OPERATOR_OVERLOAD(^,  LXOR);
+    M_SCALAR_OPERATOR_OVERLOAD(<<, SHL);
+    M_SCALAR_OPERATOR_OVERLOAD(>>, SHR);
+    M_SCALAR_OPERATOR_OVERLOAD(&&, AND);
+    M_SCALAR_OPERATOR_OVERLOAD(||, OR);
+    M_SCALAR_OPERATOR_OVERLOAD(==, EQ);
+    M_SCALAR_OPERATOR_OVERLOAD(!=, NEQ);
+    M_SCALAR_OPERATOR_OVERLOAD(<,  LT);
+    M_SCALAR_OPERATOR_OVERLOAD(<=, LE);
+    M_SCALAR_OPERATOR_OVERLOAD(>,  GT);
+    M_SCALAR_OPERATOR_OVERLOAD(>=, GE);
+
+#undef M_SCALAR_OPERATOR_OVERLOAD
+
+#if defined(__cpp_impl_three_way_comparison)
+    // (since C++20, 'lazy_a == 1' also considers the reversed scalar overload, which binds a non const expression better than its members,
+    //  so comparisons of an expression against a scalar are declared as free functions too, and are preferred over any reversed candidate)
+#define M_SCALAR_OPERATOR_OVERLOAD(OP)                                                                                                                                                    \
+    template<typename E, typename S, typename std::enable_if<detail::Concepts::is_scalar_operand_v<S, E>>::type* = nullptr>                                                              \
+    constexpr auto operator OP (E&& xi_expression, S&& xi_scalar) -> decltype(std::forward<E>(xi_expression).operator OP(std::forward<S>(xi_scalar))) {                                \
+        return std::forward<E>(xi_expression).operator OP(std::forward<S>(xi_scalar));                                                                                                    \
+    }
+
+    M_SCALAR_OPERATOR_OVERLOAD(==);
+    M_SCALAR_OPERATOR_OVERLOAD(!=);
+
+#undef M_SCALAR_OPERATOR_OVERLOAD
+#endif
+
+    /**
+    * \brief a destination wrapper which only assigns to elements of a lazy container where a condition holds.
+    *
+    * @param{COLLECTION} the collection wrapped by the destination container.
+    * @param{CondExpr}   condition expression.
+    *
+    * \remarks vectorizable assignments are evaluated as a (branchless) blend between the assigned and the current value,
+    *          otherwise the assigned expression is only evaluated where the condition holds.
+    **/
+    template<typename COLLECTION, typename CondExpr> class Masked {
+        public:
+            using value_type = typename Container<COLLECTION>::value_type;
+
+            //
+            // constructors
+            //
+
+            Masked(Container<COLLECTION>& xi_destination, CondExpr xi_cond) : m_destination(xi_destination), m_cond(std::forward<CondExpr>(xi_cond)) {}
+
+            //
+            // operator overloading
+            //
+
+#define M_OPERATOR_OVERLOAD(AOP, NAME)                                                                                                                       \
+            template<typename T, typename std::enable_if<detail::Concepts::is_expression_v<T> || std::is_convertible_v<T, value_type>>::type* = nullptr>       \
+            Masked& operator AOP (T&& xi_expression) {                                                                                                         \
+                evaluate<NAME>(detail::operand<value_type>(std::forward<T>(xi_expression)));                                                                   \
+                return *this;                                                                                                                                  \
+            }
+
+            M_OPERATOR_OVERLOAD(=,   detail::BinaryOperations::ASSIGN<value_type>);
+            M_OPERATOR_OVERLOAD(+=,  detail::BinaryOperations::ADD<value_type>);
+            M_OPERATOR_OVERLOAD(-=,  detail::BinaryOperations::SUB<value_type>);
+            M_OPERATOR_OVERLOAD(*=,  detail::BinaryOperations::MUL<value_type>);
+            M_OPERATOR_OVERLOAD(/=,  detail::BinaryOperations::DIV<value_type>);
+            M_OPERATOR_OVERLOAD(&=,  detail::BinaryOperations::LAND<value_type>);
+            M_OPERATOR_OVERLOAD(|=,  detail::BinaryOperations::LOR<value_type>);
+            M_OPERATOR_OVERLOAD(^=,  detail::BinaryOperations::LXOR<value_type>);
+            M_OPERATOR_OVERLOAD(<<=, detail::BinaryOperations::SHL<value_type>);
+            M_OPERATOR_OVERLOAD(>>=, detail::BinaryOperations::SHR<value_type>);
+
+#undef M_OPERATOR_OVERLOAD
+
+        // internal
+        private:
+
+            // evaluate expression where condition holds
+            template<typename AssignOp, typename T> void evaluate(const T& xi_expression) {
+                if constexpr (detail::Concepts::has_chain_v<T>) {
+                    return evaluate<AssignOp>(detail::flatten(xi_expression));
+                }
+                detail::Instrumentation::measure<AssignOp, value_type>("masked", xi_expression, m_destination.size(), Container<COLLECTION>::is_vectorizable && std::decay_t<T>::is_vectorizable,
+                                                                       [this, &xi_expression] { evaluate_masked<AssignOp>(xi_expression); });
+            }
+
+            template<typename AssignOp, typename T> void evaluate_masked(const T& xi_expression) {
+                const std::size_t len{ m_destination.size() };
+                assert(detail::matching_size(xi_expression.size(), len) && detail::matching_size(m_cond.size(), len));
+                detail::prepare(xi_expression, 0, 0);
+                detail::prepare(m_cond, 0, 0);
+
+                // expressions which read the destination at other indices are evaluated into a scratch buffer first
+                if constexpr (!(std::decay_t<T>::is_elementwise && std::decay_t<CondExpr>::is_elementwise)) {
+                    const detail::Region destination{ m_destination.region() };
+                    const detail::Alias alias{ detail::combine(xi_expression.alias(destination), m_cond.alias(destination)) };
+                    if ((alias != detail::Alias::none) && (alias != detail::Alias::elementwise)) {
+                        std::vector<value_type> scratch;
+                        std::vector<char> selected(len);
+                        scratch.reserve(len);
+                        for (std::size_t i{}; i < len; ++i) {
+                            selected[i] = static_cast<bool>(m_cond[i]);
+                            scratch.emplace_back(selected[i] ? value_type(xi_expression[i]) : value_type{});
+                        }
+                        for (std::size_t i{}; i < len; ++i) {
+                            if (selected[i]) {
+                                AssignOp::assign(m_destination[i], std::move(scratch[i]));
+                            }
+                        }
+                        return;
+                    }
+                }
+
+                // (an operation which can trap on unselected lanes, i.e. - an integral division guarded by the mask, is only evaluated where the condition holds)
+                if constexpr (Container<COLLECTION>::is_vectorizable && detail::Concepts::has_packet_of_v<T, value_type> &&
+                              !detail::Concepts::is_trapping<AssignOp>::value && !detail::Concepts::may_trap_v<T>) {
+                    // blend assigned and current values, so the packet loop stays branchless
+                    using packet_type = detail::Simd::Packet<value_type>;
+                    value_type* data{ m_destination.m_container.data() };
+                    std::size_t i{};
+
+                    for (; i + packet_type::size <= len; i += packet_type::size) {
+                        const packet_type current{ packet_type::load(data + i) };
+                        detail::select(m_cond, i, AssignOp::apply(current, detail::packet_as<value_type>(xi_expression, i)), current).store(data + i);
+                    }
+
+                    for (; i < len; ++i) {
+                        if (static_cast<bool>(m_cond[i])) {
+                            AssignOp::assign(m_destination[i], xi_expression[i]);
+                        }
+                    }
+                } else {
+                    for (std::size_t i{}; i < len; ++i) {
+                        if (static_cast<bool>(m_cond[i])) {
+                            AssignOp::assign(m_destination[i], xi_expression[i]);
+                        }
+                    }
+                }
+            }
+
+        // properties
+        private:
+            Container<COLLECTION>& m_destination;
+            CondExpr m_cond;
+    };
+
+    /**
+    * \brief a destination wrapper which evaluates expressions into a lazy container using multiple threads.
+    *
+    * @param{COLLECTION} the collection wrapped by the destination container.
+    *
+    * \remarks the index range is split into cache line aligned chunks (so no two threads write to the same cache line)
+    *          and evaluated by 'detail::ThreadPool'. ranges shorter than the grain size are evaluated serially.
+    **/
+    template<typename COLLECTION> class Parallel {
+        public:
+            using value_type = typename Container<COLLECTION>::value_type;
+
+            //
+            // constructors
+            //
+
+            Parallel(Container<COLLECTION>& xi_destination, std::size_t xi_grain) : m_destination(xi_destination), m_grain(std::max<std::size_t>(1, xi_grain)) {}
+
+            // destination wrappers which fall back to parallel evaluation
+            template<typename> friend class Offload;
+
+            // assign from a (right) expression
+            template<typename T, typename std::enable_if<detail::Concepts::is_expression_v<T> || std::is_convertible_v<T, value_type>>::type* = nullptr>
+            Parallel& operator =(T&& xi_expression) {
+                evaluate<detail::BinaryOperations::ASSIGN<value_type>>(detail::operand<value_type>(std::forward<T>(xi_expression)));
+                return *this;
+            }
+
+            //
+            // operator overloading
+            //
+
+#define M_OPERATOR_OVERLOAD(AOP, NAME)                                                                                                                       \
+            template<typename T, typename std::enable_if<detail::Concepts::is_expression_v<T> || std::is_convertible_v<T, value_type>>::type* = nullptr>       \
+            Parallel& operator AOP (T&& xi_expression) {                                                                                                       \
+                evaluate<NAME>(detail::operand<value_type>(std::forward<T>(xi_expression)));                                                                   \
+                return *this;                                                                                                                                  \
+            }
+
+            M_OPERATOR_OVERLOAD(+=,  detail::BinaryOperations::ADD<value_type>);
+            M_OPERATOR_OVERLOAD(-=,  detail::BinaryOperations::SUB<value_type>);
+            M_OPERATOR_OVERLOAD(*=,  detail::BinaryOperations::MUL<value_type>);
+            M_OPERATOR_OVERLOAD(/=,  detail::BinaryOperations::DIV<value_type>);
+            M_OPERATOR_OVERLOAD(&=,  detail::BinaryOperations::LAND<value_type>);
+            M_OPERATOR_OVERLOAD(|=,  detail::BinaryOperations::LOR<value_type>);
+            M_OPERATOR_OVERLOAD(^=,  detail::BinaryOperations::LXOR<value_type>);
+            M_OPERATOR_OVERLOAD(<<=, detail::BinaryOperations::SHL<value_type>);
+            M_OPERATOR_OVERLOAD(>>=, detail::BinaryOperations::SHR<value_type>);
+
+#undef M_OPERATOR_OVERLOAD
+
+        // internal
+        private:
+
+            // evaluate an expression in parallel chunks (chunks are only independent if expression reads the destination element wise)
+            template<typename AssignOp, typename T> void evaluate(const T& xi_expression) {
+                if constexpr (detail::Concepts::has_chain_v<T>) {
+                    return evaluate<AssignOp>(detail::flatten(xi_expression));
+                }
+                detail::Instrumentation::measure<AssignOp, value_type>("parallel", xi_expression, m_destination.size(), Container<COLLECTION>::is_vectorizable && std::decay_t<T>::is_vectorizable,
+                                                                       [this, &xi_expression] { evaluate_chunks<AssignOp>(xi_expression); });
+            }
+
+            template<typename AssignOp, typename T> void evaluate_chunks(const T& xi_expression) {
+                assert(detail::matching_size(xi_expression.size(), m_destination.size()));
+                if constexpr (detail::Concepts::is_stateful_v<T>) {
+                    m_destination.template assign<AssignOp>(xi_expression);
+                    return;
+                }
+                else if constexpr (!std::decay_t<T>::is_elementwise) {
+                    const detail::Alias alias{ xi_expression.alias(m_destination.region()) };
+                    if ((alias != detail::Alias::none) && (alias != detail::Alias::elementwise)) {
+                        m_destination.template assign<AssignOp>(xi_expression);
+                        return;
+                    }
+                }
+
+                for_each_chunk([&](std::size_t xi_first, std::size_t xi_last) {
+                    m_destination.template evaluate<AssignOp>(xi_expression, xi_first, xi_last);
+                });
+            }
+
+            // split destination into cache line aligned chunks and evaluate them (serially if destination is shorter than grain)
+            template<typename F> void for_each_chunk(F&& xi_task) {
+                constexpr std::size_t line{ std::max<std::size_t>(1, detail::cache_line / sizeof(value_type)) };
+                detail::for_each_chunk(m_destination.size(), m_grain, line, detail::line_offset(m_destination.collection()), [&](std::size_t, std::size_t xi_first, std::size_t xi_last) {
+                    xi_task(xi_first, xi_last);
+                });
+            }
+
+        // properties
+        private:
+            Container<COLLECTION>& m_destination;
+            std::size_t m_grain;
+    };
+
+    /**
+    * \brief evaluate assignments into a lazy container using multiple threads, i.e. - 'Lazy::par(lazy_d) += lazy_a + lazy_b'.
+    *
+    * @param {xi_destination, in} destination container
+    * @param {xi_grain,       in} amount of elements below which evaluation stays serial
+    * @param {return,         out} parallel destination wrapper
+    **/
+    template<typename COLLECTION> Parallel<COLLECTION> par(Container<COLLECTION>& xi_destination, std::size_t xi_grain = detail::parallel_grain) {
+        return Parallel<COLLECTION>(xi_destination, xi_grain);
+    }
+
+    /**
+    * \brief a destination wrapper which evaluates expressions into a lazy container tile by tile.
+    *
+    * @param{COLLECTION} the collection wrapped by the destination container.
+    *
+    * \remarks before a tile is evaluated, cached operands (see 'Lazy::cache') which can not be evaluated in packets are
+    *          materialized into a per tile buffer, and contiguous leaves prefetch the following tile.
+    **/
+    template<typename COLLECTION> class Tiled {
+        public:
+            using value_type = typename Container<COLLECTION>::value_type;
+
+            //
+            // constructors
+            //
+
+            Tiled(Container<COLLECTION>& xi_destination, std::size_t xi_tile_bytes) : m_destination(xi_destination) {
+                constexpr std::size_t line{ std::max<std::size_t>(1, detail::cache_line / sizeof(value_type)) };
+                m_tile = std::max<std::size_t>(1, xi_tile_bytes / sizeof(value_type) / line) * line;
+            }
+
+            // assign from a (right) expression
+            template<typename T, typename std::enable_if<detail::Concepts::is_expression_v<T> || std::is_convertible_v<T, value_type>>::type* = nullptr>
+            Tiled& operator =(T&& xi_expression) {
+                evaluate<detail::BinaryOperations::ASSIGN<value_type>>(detail::operand<value_type>(std::forward<T>(xi_expression)));
+                return *this;
+            }
+
+            //
+            // operator overloading
+            //
+
+#define M_OPERATOR_OVERLOAD(AOP, NAME)                                                                                                                       \
+            template<typename T, typename std::enable_if<detail::Concepts::is_expression_v<T> || std::is_convertible_v<T, value_type>>::type* = nullptr>       \
+            Tiled& operator AOP (T&& xi_expression) {                                                                                                          \
+                evaluate<NAME>(detail::operand<value_type>(std::forward<T>(xi_expression)));                                                                   \
+                return *this;                                                                                                                                  \
+            }
+
+            M_OPERATOR_OVERLOAD(+=,  detail::BinaryOperations::ADD<value_type>);
+            M_OPERATOR_OVERLOAD(-=,  detail::BinaryOperations::SUB<value_type>);
+            M_OPERATOR_OVERLOAD(*=,  detail::BinaryOperations::MUL<value_type>);
+            M_OPERATOR_OVERLOAD(/=,  detail::BinaryOperations::DIV<value_type>);
+            M_OPERATOR_OVERLOAD(&=,  detail::BinaryOperations::LAND<value_type>);
+            M_OPERATOR_OVERLOAD(|=,  detail::BinaryOperations::LOR<value_type>);
+            M_OPERATOR_OVERLOAD(^=,  detail::BinaryOperations::LXOR<value_type>);
+            M_OPERATOR_OVERLOAD(<<=, detail::BinaryOperations::SHL<value_type>);
+            M_OPERATOR_OVERLOAD(>>=, detail::BinaryOperations::SHR<value_type>);
+
+#undef M_OPERATOR_OVERLOAD
+
+        // internal
+        private:
+
+            // evaluate an expression tile by tile (tiles are only independent if expression reads the destination element wise)
+            template<typename AssignOp, typename T> void evaluate(const T& xi_expression) {
+                if constexpr (detail::Concepts::has_chain_v<T>) {
+                    return evaluate<AssignOp>(detail::flatten(xi_expression));
+                }
+                detail::Instrumentation::measure<AssignOp, value_type>("tiled", xi_expression, m_destination.size(), Container<COLLECTION>::is_vectorizable && std::decay_t<T>::is_vectorizable,
+                                                                       [this, &xi_expression] { evaluate_tiles<AssignOp>(xi_expression); });
+            }
+
+            template<typename AssignOp, typename T> void evaluate_tiles(const T& xi_expression) {
+                assert(detail::matching_size(xi_expression.size(), m_destination.size()));
+                if constexpr (!std::decay_t<T>::is_elementwise) {
+                    const detail::Alias alias{ xi_expression.alias(m_destination.region()) };
+                    if ((alias != detail::Alias::none) && (alias != detail::Alias::elementwise)) {
+                        m_destination.template assign<AssignOp>(xi_expression);
+                        return;
+                    }
+                }
+
+                const std::size_t len{ m_destination.size() };
+                detail::prepare(xi_expression, 0, 0);
+                for (std::size_t first{}; first < len; first += m_tile) {
+                    const std::size_t last{ std::min(first + m_tile, len) };
+                    detail::prepare(xi_expression, first, last);
+                    m_destination.template evaluate<AssignOp>(xi_expression, first, last);
+                }
+                detail::prepare(xi_expression, 0, 0);
+            }
+
+        // properties
+        private:
+            Container<COLLECTION>& m_destination;
+            std::size_t m_tile;
+    };
+
+    /**
+    * \brief evaluate assignments into a lazy container tile by tile, i.e. - 'Lazy::tiled(lazy_d) = Lazy::cache(lazy_a + lazy_b) * lazy_c'.
+    *
+    * @param {xi_destination, in}  destination container
+    * @param {xi_tile_bytes,  in}  amount of destination bytes per tile (rounded to cache lines)
+    * @param {return,         out} tiled destination wrapper
+    **/
+    template<typename COLLECTION> Tiled<COLLECTION> tiled(Container<COLLECTION>& xi_destination, std::size_t xi_tile_bytes = detail::tile_bytes) {
+        return Tiled<COLLECTION>(xi_destination, xi_tile_bytes);
+    }
+
+    /**
+    * \brief a destination wrapper which overwrites a lazy container with non temporal (streaming) stores, for large destinations
+    *        which are not read soon after the assignment (so they neither evict the cache nor are read for ownership).
+    *
+    * @param{COLLECTION} the collection wrapped by the destination container.
+    *
+    * \remarks chunks (see 'Lazy::par') store their unaligned head and tail elements, stream the packets between them and fence.
+    *          destinations shorter than the threshold, which are not contiguous arithmetic collections, or expressions which can not be
+    *          evaluated in packets or read the destination other than element wise, are assigned as usual.
+    **/
+    template<typename COLLECTION> class Stream {
+        public:
+            using value_type = typename Container<COLLECTION>::value_type;
+
+            //
+            // constructors
+            //
+
+            Stream(Container<COLLECTION>& xi_destination, std::size_t xi_threshold_bytes) : m_destination(xi_destination), m_threshold(xi_threshold_bytes) {}
+
+            // assign from a (right) expression
+            template<typename T, typename std::enable_if<detail::Concepts::is_expression_v<T> || std::is_convertible_v<T, value_type>>::type* = nullptr>
+            Stream& operator =(T&& xi_expression) {
+                evaluate(detail::operand<value_type>(std::forward<T>(xi_expression)));
+                return *this;
+            }
+
+            // is an expression streamed (given a destination of at least the threshold)?
+            template<typename T> static constexpr bool is_streamed = detail::Simd::streamed && Container<COLLECTION>::is_vectorizable && detail::Concepts::has_packet_of_v<T, value_type> &&
+                                                                     !detail::Concepts::is_stateful_v<T>;
+
+        // internal
+        private:
+            using assign_type = detail::BinaryOperations::ASSIGN<value_type>;
+
+            template<typename T> void evaluate(const T& xi_expression) {
+                if constexpr (detail::Concepts::has_chain_v<T>) {
+                    return evaluate(detail::flatten(xi_expression));
+                }
+                if constexpr (is_streamed<T>) {
+                    const std::size_t len{ static_cast<std::size_t>(m_destination.size()) };
+                    const detail::Alias alias{ xi_expression.alias(m_destination.region()) };
+                    if ((len * sizeof(value_type) >= m_threshold) && ((alias == detail::Alias::none) || (alias == detail::Alias::elementwise))) {
+                        assert(detail::matching_size(xi_expression.size(), m_destination.size()));
+                        detail::Instrumentation::measure<assign_type, value_type>("stream", xi_expression, len, true, [this, &xi_expression, len] {
+                            constexpr std::size_t line{ std::max<std::size_t>(1, detail::cache_line / sizeof(value_type)) };
+                            detail::for_each_chunk(len, detail::parallel_grain, line, detail::line_offset(m_destination.collection()), [this, &xi_expression](std::size_t, std::size_t xi_first, std::size_t xi_last) {
+                                evaluate_chunk(xi_expression, xi_first, xi_last);
+                            });
+                        });
+                        return;
+                    }
+                }
+                m_destination.template assign<assign_type>(xi_expression);
+            }
+
+            // evaluate a chunk, storing the elements up to the first (from the last) register aligned element and streaming the packets between them
+            template<typename T> void evaluate_chunk(const T& xi_expression, std::size_t xi_first, std::size_t xi_last) {
+                using packet_type = detail::Simd::Packet<value_type>;
+                value_type* data{ m_destination.collection().data() };
+                const std::size_t misalignment{ (reinterpret_cast<std::uintptr_t>(data + xi_first) % detail::Simd::width) / sizeof(value_type) },
+                                  head{ std::min(xi_last, xi_first + ((misalignment == 0) ? 0 : (packet_type::size - misalignment))) };
+
+                if ((reinterpret_cast<std::uintptr_t>(data) % sizeof(value_type) != 0) || (xi_last - head < packet_type::size)) {
+                    m_destination.template evaluate<assign_type>(xi_expression, xi_first, xi_last);
+                    return;
+                }
+
+                std::size_t i{ xi_first };
+                for (; i < head; ++i) {
+                    assign_type::assign(data[i], xi_expression[i]);
+                }
+                for (; i + packet_type::size <= xi_last; i += packet_type::size) {
+                    detail::packet_as<value_type>(xi_expression, i).stream(data + i);
+                }
+                for (; i < xi_last; ++i) {
+                    assign_type::assign(data[i], xi_expression[i]);
+                }
+                detail::Simd::fence();
+            }
+
+        // properties
+        private:
+            Container<COLLECTION>& m_destination;
+            std::size_t m_threshold;
+    };
+
+    /**
+    * \brief overwrite a lazy container with non temporal (streaming) stores, i.e. - 'Lazy::stream(lazy_d) = lazy_a * lazy_b + lazy_c'.
+    *
+    * @param {xi_destination,     in}  destination container
+    * @param {xi_threshold_bytes, in}  amount of destination bytes below which stores are cached
+    * @param {return,             out} streaming destination wrapper
+    **/
+    template<typename COLLECTION> Stream<COLLECTION> stream(Container<COLLECTION>& xi_destination, std::size_t xi_threshold_bytes = detail::stream_bytes) {
+        return Stream<COLLECTION>(xi_destination, xi_threshold_bytes);
+    }
+
+    namespace detail {
+
+        /**
+        * offloading of assignments to an accelerator (an OpenMP target device), enabled by compiling with OpenMP and defining 'MAKELAZY_OFFLOAD'.
+        *
+        * \remarks an expression tree (of container leaves, scalars, unary, binary and conditional nodes over arithmetic elements) is lowered into
+        *          an equivalent tree whose container leaves read device buffers, which is evaluated by a single (fused) target loop.
+        *          the elements of a resident container (see 'Lazy::resident') are transferred once and kept on the device, otherwise
+        *          they are transferred for every assignment.
+        **/
+        namespace Offload {
+
+            // amount of destination elements below which an assignment is not worth the transfers to the device
+            constexpr std::size_t grain{ 1 << 20 };
+
+#if defined(MAKELAZY_TARGET)
+            constexpr bool enabled{ true };
+#else
+            constexpr bool enabled{ false };
+#endif
+
+            namespace Concepts {
+                // test if an expression can be evaluated on the device
+                template<typename>                           struct is_offloadable                                 : std::false_type {};
+                template<typename T>                         struct is_offloadable<Scalar<T>>                      : std::is_arithmetic<T> {};
+                template<typename C>                         struct is_offloadable<Container<C>>                   : std::bool_constant<std::is_arithmetic_v<typename C::value_type> && detail::Concepts::has_data_v<const C> &&
+                                                                                                                                        !detail::Concepts::is_window<std::remove_const_t<C>>::value> {};
+                template<typename E, typename U>             struct is_offloadable<UnaryExpression<E, U>>          : std::bool_constant<is_offloadable<std::decay_t<E>>::value && std::is_arithmetic_v<typename UnaryExpression<E, U>::value_type>> {};
+                template<typename L, typename B, typename R> struct is_offloadable<BinaryExpression<L, B, R>>      : std::bool_constant<is_offloadable<std::decay_t<L>>::value && is_offloadable<std::decay_t<R>>::value &&
+                                                                                                                                        std::is_arithmetic_v<typename BinaryExpression<L, B, R>::value_type>> {};
+                template<typename C, typename T, typename E> struct is_offloadable<WhereExpression<C, T, E>>       : std::bool_constant<is_offloadable<std::decay_t<C>>::value && is_offloadable<std::decay_t<T>>::value &&
+                                                                                                                                        is_offloadable<std::decay_t<E>>::value> {};
+                template<typename T, typename B, typename... Exprs> struct is_offloadable<ChainExpression<T, B, Exprs...>> : std::bool_constant<(is_offloadable<std::decay_t<Exprs>>::value && ...) && std::is_arithmetic_v<T>> {};
+                template<typename T> constexpr bool is_offloadable_v = is_offloadable<std::decay_t<T>>::value;
+            }
+
+#if defined(MAKELAZY_TARGET)
+            /**
+            * \brief device buffers of host collections, keyed by their elements (a resident buffer outlives assignments, until it is evicted)
+            **/
+            class Buffers {
+                // properties
+                private:
+                    struct Buffer {
+                        void*       m_device;
+                        std::size_t m_bytes;
+                        bool        m_resident;
+                    };
+                    std::unordered_map<const void*, Buffer> m_buffers;
+                    std::mutex                              m_mutex;
+                    int                                     m_device{ omp_get_default_device() };
+
+                // constructors
+                private:
+                    Buffers() = default;
+                    ~Buffers() {
+                        for (const auto& buffer : m_buffers) {
+                            omp_target_free(buffer.second.m_device, m_device);
+                        }
+                    }
+
+                public:
+                    Buffers(const Buffers&)             = delete;
+                    Buffers& operator =(const Buffers&) = delete;
+
+                    static Buffers& instance() {
+                        static Buffers buffers;
+                        return buffers;
+                    }
+
+                // methods
+                public:
+
+                    // device buffer to evaluate a host collection (its elements are transferred unless they are already resident, or 'xi_upload' is false)
+                    void* acquire(const void* xi_host, std::size_t xi_bytes, bool xi_upload) {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        auto it{ m_buffers.find(xi_host) };
+                        if ((it != m_buffers.end()) && (it->second.m_bytes != xi_bytes)) {
+                            omp_target_free(it->second.m_device, m_device);
+                            it->second = Buffer{ allocate(xi_bytes), xi_bytes, it->second.m_resident };
+                        } else if (it == m_buffers.end()) {
+                            it = m_buffers.emplace(xi_host, Buffer{ allocate(xi_bytes), xi_bytes, false }).first;
+                        } else if (it->second.m_resident) {
+                            return it->second.m_device;
+                        }
+
+                        if (xi_upload && (xi_bytes > 0)) {
+                            omp_target_memcpy(it->second.m_device, const_cast<void*>(xi_host), xi_bytes, 0, 0, m_device, omp_get_initial_device());
+                        }
+                        return it->second.m_device;
+                    }
+
+                    // copy a device buffer back into its host collection
+                    void download(void* xo_host, const void* xi_device, std::size_t xi_bytes) const {
+                        if (xi_bytes > 0) {
+                            omp_target_memcpy(xo_host, const_cast<void*>(xi_device), xi_bytes, 0, 0, omp_get_initial_device(), m_device);
+                        }
+                    }
+
+                    // release the buffer of a host collection which is not resident (the buffer of a resident collection is released by evicting it)
+                    void release(const void* xi_host, bool xi_evict = false) {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        const auto it{ m_buffers.find(xi_host) };
+                        if ((it != m_buffers.end()) && (xi_evict || !it->second.m_resident)) {
+                            omp_target_free(it->second.m_device, m_device);
+                            m_buffers.erase(it);
+                        }
+                    }
+
+                    // keep the elements of a host collection on the device (transferred by the next assignment reading them)
+                    void keep(const void* xi_host) {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        const auto it{ m_buffers.find(xi_host) };
+                        if (it != m_buffers.end()) {
+                            omp_target_free(it->second.m_device, m_device);
+                            m_buffers.erase(it);
+                        }
+                        m_buffers.emplace(xi_host, Buffer{ nullptr, unbounded, true });
+                    }
+
+                    // device the buffers are allocated on
+                    int device() const noexcept { return m_device; }
+
+                // internal
+                private:
+                    void* allocate(std::size_t xi_bytes) {
+                        void* device{ omp_target_alloc(std::max<std::size_t>(1, xi_bytes), m_device) };
+                        if (device == nullptr) {
+                            throw std::bad_alloc();
+                        }
+                        return device;
+                    }
+            };
+
+            /**
+            * \brief a leaf reading the elements of a device buffer
+            **/
+            template<typename T> class Leaf {
+                // aliases
+                public:
+                    using value_type = T;
+
+                // properties
+                private:
+                    const T*    m_data;
+                    std::size_t m_size;
+
+                // constructors
+                public:
+                    constexpr Leaf(const T* xi_data, std::size_t xi_size) noexcept : m_data(xi_data), m_size(xi_size) {}
+
+                // getters
+                public:
+                    constexpr std::size_t size() const noexcept { return m_size; }
+                    static constexpr bool is_elementwise = true;
+                    constexpr Alias alias(const Region&) const noexcept { return Alias::none; }
+                    static constexpr bool is_vectorizable = false;
+                    constexpr T operator [](std::size_t index) const noexcept { return m_data[index]; }
+            };
+
+            /**
+            * \brief leaves (host collections) transferred for an assignment, whose buffers are released once it is evaluated (unless they are resident)
+            **/
+            class Transfers {
+                // properties
+                private:
+                    std::vector<const void*> m_hosts;
+
+                // constructors
+                public:
+                    Transfers() = default;
+                    Transfers(const Transfers&)             = delete;
+                    Transfers& operator =(const Transfers&) = delete;
+                    ~Transfers() {
+                        for (const void* host : m_hosts) {
+                            Buffers::instance().release(host);
+                        }
+                    }
+
+                // methods
+                public:
+
+                    // device buffer of a host collection
+                    template<typename T> T* acquire(const T* xi_host, std::size_t xi_size, bool xi_upload = true) {
+                        if (std::find(m_hosts.begin(), m_hosts.end(), static_cast<const void*>(xi_host)) == m_hosts.end()) {
+                            m_hosts.push_back(xi_host);
+                        } else {
+                            xi_upload = false;
+                        }
+                        return static_cast<T*>(Buffers::instance().acquire(xi_host, xi_size * sizeof(T), xi_upload));
+                    }
+            };
+
+            // an expression tree whose container leaves read device buffers
+            template<typename T> constexpr Scalar<T> lower(const Scalar<T>& xi_scalar, Transfers&) noexcept {
+                return xi_scalar;
+            }
+
+            template<typename C> auto lower(const Container<C>& xi_container, Transfers& xio_transfers) {
+                using value_type = typename Container<C>::value_type;
+                const std::size_t len{ static_cast<std::size_t>(xi_container.size()) };
+                return Leaf<value_type>(xio_transfers.acquire(static_cast<const value_type*>(xi_container.collection().data()), len), len);
+            }
+
+            template<typename E, typename U> auto lower(const UnaryExpression<E, U>& xi_expression, Transfers& xio_transfers) {
+                return UnaryExpression<decltype(lower(xi_expression.e(), xio_transfers)), U>(lower(xi_expression.e(), xio_transfers));
+            }
+
+            template<typename L, typename B, typename R> auto lower(const BinaryExpression<L, B, R>& xi_expression, Transfers& xio_transfers) {
+                auto left{ lower(xi_expression.le(), xio_transfers) };
+                auto right{ lower(xi_expression.re(), xio_transfers) };
+                return BinaryExpression<decltype(left), B, decltype(right)>(std::move(left), std::move(right));
+            }
+
+            template<typename C, typename T, typename E> auto lower(const WhereExpression<C, T, E>& xi_expression, Transfers& xio_transfers) {
+                auto cond{ lower(xi_expression.ce(), xio_transfers) };
+                auto then{ lower(xi_expression.te(), xio_transfers) };
+                auto other{ lower(xi_expression.ee(), xio_transfers) };
+                return WhereExpression<decltype(cond), decltype(then), decltype(other)>(std::move(cond), std::move(then), std::move(other));
+            }
+
+            template<typename T, typename B, typename... Exprs> auto lower(const ChainExpression<T, B, Exprs...>& xi_expression, Transfers& xio_transfers) {
+                return std::apply([&xio_transfers](const auto&... operands) {
+                    return ChainExpression<T, B, decltype(lower(operands, xio_transfers))...>(lower(operands, xio_transfers)...);
+                }, xi_expression.operands());
+            }
+
+            /**
+            * \brief evaluate an expression into the elements of a host collection on the device
+            *
+            * @param {AssignOp,      in}  binary operation assigning expression element into destination element
+            * @param {xo_data,       out} elements of destination
+            * @param {xi_size,       in}  amount of elements of destination
+            * @param {xi_expression, in}  (offloadable) expression
+            **/
+            template<typename AssignOp, typename V, typename E> void evaluate(V* xo_data, std::size_t xi_size, const E& xi_expression) {
+                Transfers transfers;
+                const auto device_expression{ lower(xi_expression, transfers) };
+                constexpr bool reads_destination{ !std::is_same_v<AssignOp, BinaryOperations::ASSIGN<V>> };
+                V* out{ transfers.acquire(static_cast<const V*>(xo_data), xi_size, reads_destination) };
+                const int device{ Buffers::instance().device() };
+
+#pragma omp target teams distribute parallel for is_device_ptr(out) firstprivate(device_expression) device(device)
+                for (std::size_t i = 0; i < xi_size; ++i) {
+                    AssignOp::assign(out[i], device_expression[i]);
+                }
+
+                Buffers::instance().download(xo_data, out, xi_size * sizeof(V));
+            }
+#endif
+        }
+    }
+
+    /**
+    * \brief a destination wrapper which evaluates expressions into a lazy container on an accelerator (see 'detail::Offload').
+    *
+    * @param{COLLECTION} the collection wrapped by the destination container.
+    *
+    * \remarks expressions which can not be evaluated on the device, destinations shorter than the grain, and any expression when offloading
+    *          is not enabled, are evaluated in parallel on the host (see 'Lazy::par').
+    **/
+    template<typename COLLECTION> class Offload {
+        public:
+            using value_type = typename Container<COLLECTION>::value_type;
+
+            //
+            // constructors
+            //
+
+            Offload(Container<COLLECTION>& xi_destination, std::size_t xi_grain) : m_destination(xi_destination), m_grain(xi_grain) {}
+
+            // assign from a (right) expression
+            template<typename T, typename std::enable_if<detail::Concepts::is_expression_v<T> || std::is_convertible_v<T, value_type>>::type* = nullptr>
+            Offload& operator =(T&& xi_expression) {
+                evaluate<detail::BinaryOperations::ASSIGN<value_type>>(detail::operand<value_type>(std::forward<T>(xi_expression)));
+                return *this;
+            }
+
+            //
+            // operator overloading
+            //
+
+#define M_OPERATOR_OVERLOAD(AOP, NAME)                                                                                                                       \
+            template<typename T, typename std::enable_if<detail::Concepts::is_expression_v<T> || std::is_convertible_v<T, value_type>>::type* = nullptr>       \
+            Offload& operator AOP (T&& xi_expression) {                                                                                                        \
+                evaluate<NAME>(detail::operand<value_type>(std::forward<T>(xi_expression)));                                                                   \
+                return *this;                                                                                                                                  \
+            }
+
+            M_OPERATOR_OVERLOAD(+=,  detail::BinaryOperations::ADD<value_type>);
+            M_OPERATOR_OVERLOAD(-=,  detail::BinaryOperations::SUB<value_type>);
+            M_OPERATOR_OVERLOAD(*=,  detail::BinaryOperations::MUL<value_type>);
+            M_OPERATOR_OVERLOAD(/=,  detail::BinaryOperations::DIV<value_type>);
+            M_OPERATOR_OVERLOAD(&=,  detail::BinaryOperations::LAND<value_type>);
+            M_OPERATOR_OVERLOAD(|=,  detail::BinaryOperations::LOR<value_type>);
+            M_OPERATOR_OVERLOAD(^=,  detail::BinaryOperations::LXOR<value_type>);
+            M_OPERATOR_OVERLOAD(<<=, detail::BinaryOperations::SHL<value_type>);
+            M_OPERATOR_OVERLOAD(>>=, detail::BinaryOperations::SHR<value_type>);
+
+#undef M_OPERATOR_OVERLOAD
+
+            // is an expression evaluated on the device (given a destination of at least the grain)?
+            template<typename T> static constexpr bool is_offloaded = detail::Offload::enabled && detail::Offload::Concepts::is_offloadable_v<T> &&
+                                                                      detail::Offload::Concepts::is_offloadable_v<Container<COLLECTION>>;
+
+        // internal
+        private:
+
+            template<typename AssignOp, typename T> void evaluate(const T& xi_expression) {
+                if constexpr (detail::Concepts::has_chain_v<T>) {
+                    return evaluate<AssignOp>(detail::flatten(xi_expression));
+                }
+#if defined(MAKELAZY_TARGET)
+                if constexpr (is_offloaded<T>) {
+                    if (static_cast<std::size_t>(m_destination.size()) >= m_grain) {
+                        assert(detail::matching_size(xi_expression.size(), m_destination.size()));
+                        detail::Instrumentation::measure<AssignOp, value_type>("offload", xi_expression, m_destination.size(), false, [this, &xi_expression] {
+                            detail::Offload::evaluate<AssignOp>(m_destination.collection().data(), static_cast<std::size_t>(m_destination.size()), xi_expression);
+                        });
+                        return;
+                    }
+                }
+#endif
+                Parallel<COLLECTION>(m_destination, detail::parallel_grain).template evaluate<AssignOp>(xi_expression);
+            }
+
+        // properties
+        private:
+            Container<COLLECTION>& m_destination;
+            std::size_t m_grain;
+    };
+
+    /**
+    * \brief evaluate assignments into a lazy container on an accelerator, i.e. - 'Lazy::offload(lazy_d) = lazy_a * 2.0f + lazy_b'.
+    *
+    * @param {xi_destination, in}  destination container
+    * @param {xi_grain,       in}  amount of elements below which evaluation stays on the host
+    * @param {return,         out} offloading destination wrapper
+    **/
+    template<typename COLLECTION> Offload<COLLECTION> offload(Container<COLLECTION>& xi_destination, std::size_t xi_grain = detail::Offload::grain) {
+        return Offload<COLLECTION>(xi_destination, xi_grain);
+    }
+
+    /**
+    * \brief keep the elements of a container on the accelerator between offloaded assignments (transferred once, by the first assignment reading them),
+    *        i.e. - 'Lazy::resident(lazy_a); for (...) Lazy::offload(lazy_d) += lazy_a * w;'
+    *
+    * \remarks an offloaded assignment into a resident container updates its elements on the device (and on the host), but elements changed
+    *          on the host are not seen by the device until the container is evicted (see 'Lazy::evict') or made resident again.
+    *
+    * @param {xi_container, in} container
+    **/
+    template<typename COLLECTION> void resident([[maybe_unused]] const Container<COLLECTION>& xi_container) {
+#if defined(MAKELAZY_TARGET)
+        if constexpr (detail::Offload::Concepts::is_offloadable_v<Container<COLLECTION>>) {
+            detail::Offload::Buffers::instance().keep(xi_container.collection().data());
+        }
+#endif
+    }
+
+    /**
+    * \brief release the accelerator buffer of a resident container (see 'Lazy::resident')
+    *
+    * @param {xi_container, in} container
+    **/
+    template<typename COLLECTION> void evict([[maybe_unused]] const Container<COLLECTION>& xi_container) {
+#if defined(MAKELAZY_TARGET)
+        if constexpr (detail::Offload::Concepts::is_offloadable_v<Container<COLLECTION>>) {
+            detail::Offload::Buffers::instance().release(xi_container.collection().data(), true);
+        }
+#endif
+    }
+
+    namespace detail {
+
+        /**
+        * \brief an assignment of an expression into a destination, captured to be evaluated later (see 'Lazy::deferred').
+        *
+        * @param {COLLECTION, in} collection wrapped by destination
+        * @param {AssignOp,   in} binary operation assigning expression element into destination element
+        * @param {Expr,       in} expression operand
+        **/
+        template<typename COLLECTION, typename AssignOp, typename Expr> struct Assignment {
+            Container<COLLECTION>& m_destination;
+            Expr                   m_expression;
+        };
+
+        /**
+        * \brief evaluate several (destination, expression) pairs in a single traversal of the index range.
+        *
+        * \remarks pairs are evaluated block by block, so shared operands are read from L1 and cached operands are materialized
+        *          once per block for all destinations (before any destination of the block is written).
+        *          since every block of all destinations is evaluated before the next one, this matches sequential
+        *          assignments as long as expressions read the destinations element wise, otherwise pairs are assigned sequentially.
+        **/
+        struct Fusion {
+
+            // assign expressions into destinations
+            template<typename... Cs, typename... Es> static void assign(const std::tuple<Container<Cs>&...>& xi_destinations, const Es&... xi_expressions) {
+                static_assert(sizeof...(Cs) == sizeof...(Es), "Lazy::assign_all requires an expression per destination.");
+                evaluate<std::tuple<BinaryOperations::ASSIGN<typename Container<Cs>::value_type>...>>(std::index_sequence_for<Cs...>{}, xi_destinations, std::forward_as_tuple(xi_expressions...));
+            }
+
+            // evaluate captured assignments
+            template<typename... Cs, typename... Ops, typename... Es> static void evaluate(const Assignment<Cs, Ops, Es>&... xi_assignments) {
+                evaluate<std::tuple<Ops...>>(std::index_sequence_for<Cs...>{}, std::tuple<Container<Cs>&...>(xi_assignments.m_destination...),
+                                             std::forward_as_tuple(static_cast<const std::remove_reference_t<Es>&>(xi_assignments.m_expression)...));
+            }
+
+            private:
+
+                template<typename ASSIGNS, std::size_t... I, typename... Cs, typename... Es>
+                static void evaluate(std::index_sequence<I...> xi_indices, const std::tuple<Container<Cs>&...>& xi_destinations, const std::tuple<const Es&...>& xi_expressions) {
+                    // (a fused assignment is recorded once, by its first destination and longest index range)
+                    using first_type = std::tuple_element_t<0, std::tuple<Container<Cs>...>>;
+                    const std::size_t len{ std::max<std::size_t>({ std::size_t{}, static_cast<std::size_t>(std::get<I>(xi_destinations).size())... }) };
+                    Instrumentation::measure<std::tuple_element_t<0, ASSIGNS>, typename first_type::value_type>("fused", xi_expressions, len,
+                                                                                                              ((Container<Cs>::is_vectorizable && std::decay_t<Es>::is_vectorizable) && ...),
+                                                                                                              [xi_indices, &xi_destinations, &xi_expressions] { evaluate_blocks<ASSIGNS>(xi_indices, xi_destinations, xi_expressions); });
+                }
+
+                template<typename ASSIGNS, std::size_t... I, typename... Cs, typename... Es>
+                static void evaluate_blocks(std::index_sequence<I...>, const std::tuple<Container<Cs>&...>& xi_destinations, const std::tuple<const Es&...>& xi_expressions) {
+                    assert((matching_size(std::get<I>(xi_expressions).size(), std::get<I>(xi_destinations).size()) && ...));
+
+                    // expressions reading any destination at other indices (or windows writing another destination at other indices) are assigned in order
+                    if constexpr (!(std::decay_t<Es>::is_elementwise && ...) || (Concepts::is_window<Cs>::value || ...)) {
+                        bool elementwise{ true };
+                        const auto test = [&elementwise, &xi_expressions, &xi_destinations](const Region& xi_destination) {
+                            ((elementwise = elementwise && (std::get<I>(xi_expressions).alias(xi_destination) <= Alias::elementwise) &&
+                                                           (detail::alias(std::get<I>(xi_destinations).region(), xi_destination) <= Alias::elementwise)), ...);
+                        };
+                        (test(std::get<I>(xi_destinations).region()), ...);
+
+                        if (!elementwise) {
+                            (std::get<I>(xi_destinations).template assign<std::tuple_element_t<I, ASSIGNS>>(std::get<I>(xi_expressions)), ...);
+                            return;
+                        }
+                    }
+
+                    (detail::prepare(std::get<I>(xi_expressions), 0, 0), ...);
+
+                    const std::size_t len{ std::max<std::size_t>({ std::size_t{}, static_cast<std::size_t>(std::get<I>(xi_destinations).size())... }) };
+                    constexpr std::size_t block{ std::max<std::size_t>({ std::size_t{ 1 }, tile_bytes / sizeof(typename Container<Cs>::value_type)... }) };
+                    for (std::size_t first{}; first < len; first += block) {
+                        const auto pair = [first](auto& xi_destination, const auto& xi_expression, auto xi_op) {
+                            const std::size_t size{ static_cast<std::size_t>(xi_destination.size()) },
+                                              tile_first{ std::min(first, size) },
+                                              tile_last{ std::min(first + block, size) };
+                            if (tile_first < tile_last) {
+                                detail::prepare(xi_expression, tile_first, tile_last);
+                                xi_destination.template evaluate<decltype(xi_op)>(detail::flattened(xi_expression), tile_first, tile_last);
+                            }
+                        };
+                        (pair(std::get<I>(xi_destinations), std::get<I>(xi_expressions), std::tuple_element_t<I, ASSIGNS>{}), ...);
+                    }
+
+                    (detail::prepare(std::get<I>(xi_expressions), 0, 0), ...);
+                }
+        };
+    };
+
+    /**
+    * \brief assign several expressions into several destinations in a single traversal, i.e. - 'Lazy::assign_all(std::tie(lazy_d, lazy_e), lazy_a + lazy_b, lazy_a - lazy_b)'
+    *
+    * @param {xi_destinations, in} tuple of destination containers (i.e. - 'std::tie(lazy_d, lazy_e)')
+    * @param {xi_expressions,  in} expression (or scalar) assigned into each destination (in order)
+    **/
+    template<typename... Cs, typename... Es> void assign_all(const std::tuple<Container<Cs>&...>& xi_destinations, Es&&... xi_expressions) {
+        detail::Fusion::assign(xi_destinations, detail::operand<typename Container<Cs>::value_type>(std::forward<Es>(xi_expressions))...);
+    }
+
+    /**
+    * \brief a destination wrapper whose assignments are captured (instead of evaluated) to be fused by 'Lazy::fuse'.
+    *
+    * @param{COLLECTION} the collection wrapped by the destination container.
+    **/
+    template<typename COLLECTION> class Deferred {
+        public:
+            using value_type = typename Container<COLLECTION>::value_type;
+
+            //
+            // constructors
+            //
+
+            explicit Deferred(Container<COLLECTION>& xi_destination) : m_destination(xi_destination) {}
+
+            //
+            // operator overloading
+            //
+
+#define M_OPERATOR_OVERLOAD(AOP, NAME)                                                                                                                       \
+            template<typename T, typename std::enable_if<detail::Concepts::is_expression_v<T> || std::is_convertible_v<T, value_type>>::type* = nullptr>       \
+            auto operator AOP (T&& xi_expression) const -> detail::Assignment<COLLECTION, NAME, detail::operand_t<T, value_type>> {                           \
+                return { m_destination, detail::operand<value_type>(std::forward<T>(xi_expression)) };                                                        \
+            }
+
+            M_OPERATOR_OVERLOAD(=,   detail::BinaryOperations::ASSIGN<value_type>);
+            M_OPERATOR_OVERLOAD(+=,  detail::BinaryOperations::ADD<value_type>);
+            M_OPERATOR_OVERLOAD(-=,  detail::BinaryOperations::SUB<value_type>);
+            M_OPERATOR_OVERLOAD(*=,  detail::BinaryOperations::MUL<value_type>);
+            M_OPERATOR_OVERLOAD(/=,  detail::BinaryOperations::DIV<value_type>);
+            M_OPERATOR_OVERLOAD(&=,  detail::BinaryOperations::LAND<value_type>);
+            M_OPERATOR_OVERLOAD(|=,  detail::BinaryOperations::LOR<value_type>);
+            M_OPERATOR_OVERLOAD(^=,  detail::BinaryOperations::LXOR<value_type>);
+            M_OPERATOR_OVERLOAD(<<=, detail::BinaryOperations::SHL<value_type>);
+            M_OPERATOR_OVERLOAD(>>=, detail::BinaryOperations::SHR<value_type>);
+
+#undef M_OPERATOR_OVERLOAD
+
+        // properties
+        private:
+            Container<COLLECTION>& m_destination;
+    };
+
+    /**
+    * \brief capture an assignment into a lazy container instead of evaluating it, i.e. - 'Lazy::deferred(lazy_d) = lazy_a + lazy_b'.
+    *
+    * @param {xi_destination, in}  destination container
+    * @param {return,         out} deferred destination wrapper
+    **/
+    template<typename COLLECTION> Deferred<COLLECTION> deferred(Container<COLLECTION>& xi_destination) {
+        return Deferred<COLLECTION>(xi_destination);
+    }
+
+    /**
+    * \brief evaluate several captured assignments in a single loop, i.e. - 'Lazy::fuse(Lazy::deferred(lazy_d) = lazy_a + lazy_b, Lazy::deferred(lazy_e) -= lazy_a * lazy_b)'
+    *
+    * @param {xi_assignments, in} captured assignments (evaluated as if in order, reading their operands once per block)
+    *
+    * \remarks captured assignments must be fused within the expression which captured them, as they refer to its temporaries.
+    **/
+    template<typename... Cs, typename... Ops, typename... Es> void fuse(const detail::Assignment<Cs, Ops, Es>&... xi_assignments) {
+        detail::Fusion::evaluate(xi_assignments...);
+    }
+
+    namespace detail {
+
+        // an expression owned by a task (its nodes are held by value, its leaves by reference, so leaves must outlive the task)
+        template<typename E> struct Owned {
+            E m_expression;
+        };
+
+        /**
+        * \brief a queue of tasks evaluated by worker threads (the default executor of 'Lazy::TaskGraph').
+        **/
+        class TaskQueue {
+
+            // properties
+            private:
+                std::vector<std::thread>          m_workers;
+                std::mutex                        m_mutex;
+                std::condition_variable           m_work;
+                std::deque<std::function<void()>> m_tasks;
+                bool                              m_stop{ false };
+
+            // constructors
+            public:
+
+                explicit TaskQueue(std::size_t xi_threads) {
+                    for (std::size_t i{}; i < xi_threads; ++i) {
+                        m_workers.emplace_back([this] { work(); });
+                    }
+                }
+
+                // queued tasks are evaluated before workers are stopped
+                ~TaskQueue() {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_stop = true;
+                    }
+                    m_work.notify_all();
+                    for (std::thread& worker : m_workers) {
+                        worker.join();
+                    }
+                }
+
+                TaskQueue(const TaskQueue&)             = delete;
+                TaskQueue& operator =(const TaskQueue&) = delete;
+
+                // the process wide queue (one worker per hardware thread)
+                static TaskQueue& instance() {
+                    static TaskQueue queue(std::max<std::size_t>(1, std::thread::hardware_concurrency()));
+                    return queue;
+                }
+
+            // API
+            public:
+
+                // queue a task
+                void submit(std::function<void()> xi_task) {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_tasks.push_back(std::move(xi_task));
+                    }
+                    m_work.notify_one();
+                }
+
+            // internal
+            private:
+
+                // worker loop
+                void work() {
+                    for (;;) {
+                        std::function<void()> task;
+                        {
+                            std::unique_lock<std::mutex> lock(m_mutex);
+                            m_work.wait(lock, [&] { return m_stop || !m_tasks.empty(); });
+                            if (m_tasks.empty()) {
+                                return;
+                            }
+                            task = std::move(m_tasks.front());
+                            m_tasks.pop_front();
+                        }
+                        task();
+                    }
+                }
+        };
+    };
+
+    /**
+    * \brief a graph of assignments evaluated asynchronously: an assignment waits for earlier assignments it depends on
+    *        (which write what it reads or writes, or read what it writes), while independent assignments are evaluated concurrently.
+    *
+    * \remarks dependencies are found by testing the aliasing (see 'detail::Alias') of expressions and destinations.
+    *          expression nodes are owned by the graph, while leaves (containers) must outlive the returned futures.
+    *          a failing assignment fails the assignments which depend on it (without evaluating them).
+    **/
+    class TaskGraph {
+
+        // aliases
+        public:
+            // executor: a callable invoked with every task which is ready to be evaluated
+            using executor_type = std::function<void(std::function<void()>)>;
+
+        // properties
+        private:
+            struct Task {
+                std::function<void()>                      m_evaluate;
+                std::function<bool(const detail::Region&)> m_reads;
+                detail::Region                             m_destination;
+                std::promise<void>                         m_promise;
+                std::vector<std::shared_ptr<Task>>         m_dependents;
+                std::size_t                                m_dependencies{};
+                std::exception_ptr                         m_exception;
+            };
+
+            executor_type                      m_executor;
+            std::mutex                         m_mutex;
+            std::condition_variable            m_idle;
+            std::vector<std::shared_ptr<Task>> m_tasks;   // unfinished tasks, in submission order
+            std::size_t                        m_pending{};
+
+        // constructors
+        public:
+
+            // a graph evaluated by the process wide task queue
+            TaskGraph() : m_executor([&queue = detail::TaskQueue::instance()](std::function<void()> xi_task) { queue.submit(std::move(xi_task)); }) {}
+
+            // a graph evaluated by a given executor
+            explicit TaskGraph(executor_type xi_executor) : m_executor(std::move(xi_executor)) {}
+
+            // a graph waits for its tasks
+            ~TaskGraph() { wait(); }
+
+            TaskGraph(const TaskGraph&)             = delete;
+            TaskGraph& operator =(const TaskGraph&) = delete;
+
+            // the process wide graph (see 'Lazy::async_assign')
+            static TaskGraph& instance() {
+                static TaskGraph graph;
+                return graph;
+            }
+
+        // API
+        public:
+
+            /**
+            * \brief assign an expression into a lazy container asynchronously
+            *
+            * @param {xi_destination, in}  destination container
+            * @param {xi_expression,  in}  expression (or broadcast scalar)
+            * @param {return,         out} future, ready once the assignment is evaluated
+            **/
+            template<typename COLLECTION, typename E, typename std::enable_if<detail::Concepts::is_expression_v<E> || std::is_convertible_v<E, typename Container<COLLECTION>::value_type>>::type* = nullptr>
+            std::future<void> assign(Container<COLLECTION>& xi_destination, E&& xi_expression) {
+                using value_type = typename Container<COLLECTION>::value_type;
+                using owned_type = detail::Owned<detail::operand_t<E, value_type>>;
+
+                std::shared_ptr<owned_type> expression(new owned_type{ detail::operand<value_type>(std::forward<E>(xi_expression)) });
+                std::shared_ptr<Task> task(std::make_shared<Task>());
+                task->m_evaluate    = [&xi_destination, expression] { xi_destination = expression->m_expression; };
+                task->m_reads       = [expression](const detail::Region& xi_region) { return expression->m_expression.alias(xi_region) != detail::Alias::none; };
+                task->m_destination = xi_destination.region();
+                std::future<void> out{ task->m_promise.get_future() };
+
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    for (const std::shared_ptr<Task>& earlier : m_tasks) {
+                        if ((earlier->m_destination.collection == task->m_destination.collection) || task->m_reads(earlier->m_destination) || earlier->m_reads(task->m_destination)) {
+                            earlier->m_dependents.push_back(task);
+                            ++task->m_dependencies;
+                        }
+                    }
+                    m_tasks.push_back(task);
+                    ++m_pending;
+                    if (task->m_dependencies > 0) {
+                        return out;
+                    }
+                }
+
+                submit(std::move(task));
+                return out;
+            }
+
+            // wait until every assignment is evaluated
+            void wait() {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_idle.wait(lock, [&] { return m_pending == 0; });
+            }
+
+        // internal
+        private:
+
+            // hand a ready task to the executor
+            void submit(std::shared_ptr<Task> xi_task) {
+                m_executor([this, xi_task] { run(xi_task); });
+            }
+
+            // evaluate a task, and submit the dependents it was the last dependency of
+            void run(const std::shared_ptr<Task>& xi_task) {
+                std::exception_ptr failure{ xi_task->m_exception };
+                if (!failure) {
+                    try {
+                        xi_task->m_evaluate();
+                    } catch (...) {
+                        failure = std::current_exception();
+                    }
+                }
+
+                std::vector<std::shared_ptr<Task>> ready;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_tasks.erase(std::find(m_tasks.begin(), m_tasks.end(), xi_task));
+                    for (std::shared_ptr<Task>& dependent : xi_task->m_dependents) {
+                        if (failure && !dependent->m_exception) {
+                            dependent->m_exception = failure;
+                        }
+                        if (--dependent->m_dependencies == 0) {
+                            ready.push_back(std::move(dependent));
+                        }
+                    }
+                    xi_task->m_dependents.clear();
+                }
+
+                if (failure) {
+                    xi_task->m_promise.set_exception(failure);
+                } else {
+                    xi_task->m_promise.set_value();
+                }
+                for (std::shared_ptr<Task>& dependent : ready) {
+                    submit(std::move(dependent));
+                }
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_pending == 0) {
+                    m_idle.notify_all();
+                }
+            }
+    };
+
+    /**
+    * \brief assign an expression into a lazy container asynchronously (scheduled by the process wide 'Lazy::TaskGraph'),
+    *        i.e. - 'std::future<void> done{ Lazy::async_assign(lazy_d, lazy_a + lazy_b) }'
+    **/
+    template<typename COLLECTION, typename E> std::future<void> async_assign(Container<COLLECTION>& xi_destination, E&& xi_expression) {
+        return TaskGraph::instance().assign(xi_destination, std::forward<E>(xi_expression));
+    }
+
+    namespace detail {
+
+        // class and type of the data member pointed by a member pointer
+        template<typename M>                  struct member_pointer;
+        template<typename C, typename U>      struct member_pointer<U C::*> { using class_type = C; using type = U; };
+        template<auto M> using member_t = typename member_pointer<decltype(M)>::type;
+
+        template<typename S, typename... Exprs> class SoaExpression;
+
+        namespace Concepts {
+            // test if an object is a struct of arrays operand (a lazy struct of arrays, or an expression over one)
+            template<typename>                         struct is_soa                                                : std::false_type {};
+            template<typename S, typename... Exprs>    struct is_soa<SoaExpression<S, Exprs...>>                    : std::true_type  {};
+            template<typename T, auto... MEMBERS>      struct is_soa<Container<Soa<T, MEMBERS...>>>                 : std::true_type  {};
+            template<typename T> constexpr bool is_soa_v = is_soa<std::decay_t<T>>::value;
+        }
+
+        /**
+        * \brief operand of member 'I' of a struct of arrays expression
+        *
+        * @param {I,          in}  member index
+        * @param {S,          in}  struct of arrays collection (see 'Lazy::Soa')
+        * @param {xi_operand, in}  operand: a struct of arrays operand, an aggregate (split into its members) or a scalar (broadcast to every member)
+        * @param {return,     out} member operand
+        **/
+        template<std::size_t I, typename S, typename E> decltype(auto) soa_member(const E& xi_operand) {
+            if constexpr (Concepts::is_soa_v<E>) {
+                return std::get<I>(xi_operand.members());
+            } else if constexpr (std::is_same_v<std::decay_t<E>, typename S::value_type>) {
+                return xi_operand.*std::get<I>(S::pointers);
+            } else {
+                return xi_operand;
+            }
+        }
+
+        // an expression over every member of a struct of arrays, built by applying a callable to the member operands
+        template<typename S, typename L, typename R, typename F, std::size_t... I> auto soa_apply(const L& xi_left, const R& xi_right, F xi_function, std::index_sequence<I...>) {
+            return SoaExpression<S, decltype(xi_function(soa_member<I, S>(xi_left), soa_member<I, S>(xi_right)))...>(xi_function(soa_member<I, S>(xi_left), soa_member<I, S>(xi_right))...);
+        }
+
+        /**
+        * \brief operators shared by struct of arrays operands (the operation of an aggregate is assumed to be member wise).
+        *
+        * @param {S,       in} struct of arrays collection
+        * @param {Derived, in} operand type (must define 'members()')
+        **/
+        template<typename S, typename Derived> struct SoaOperators {
+
+#define M_SOA_OPERATOR_OVERLOAD(OP)                                                                                                                  \
+            template<typename R> auto operator OP (const R& xi_right) const {                                                                       \
+                return soa_apply<S>(static_cast<const Derived&>(*this), xi_right, [](const auto& l, const auto& r) { return l OP r; },              \
+                                    std::make_index_sequence<S::members>{});                                                                         \
+            }
+
+            M_SOA_OPERATOR_OVERLOAD(+);
+            M_SOA_OPERATOR_OVERLOAD(-);
+            M_SOA_OPERATOR_OVERLOAD(*);
+            M_SOA_OPERATOR_OVERLOAD(/);
+
+#undef M_SOA_OPERATOR_OVERLOAD
+        };
+
+        /**
+        * \brief an expression over a struct of arrays, holding one (fused) expression per member
+        *
+        * @param {S,     in} struct of arrays collection
+        * @param {Exprs, in} member expressions
+        **/
+        template<typename S, typename... Exprs>
+        class SoaExpression : public SoaOperators<S, SoaExpression<S, Exprs...>> {
+
+            // aliases
+            public:
+                using value_type = typename S::value_type;
+
+            // properties
+            private:
+                std::tuple<Exprs...> m_members;
+
+            // constructors
+            public:
+                SoaExpression() = delete;
+
+                explicit SoaExpression(Exprs... xi_members) : m_members(std::move(xi_members)...) {}
+
+                // expression can not be copied...
+                SoaExpression(const SoaExpression&)             = delete;
+                SoaExpression& operator =(const SoaExpression&) = delete;
+
+                // ...only moved
+                SoaExpression(SoaExpression&&) noexcept             = default;
+                SoaExpression& operator =(SoaExpression&&) noexcept = default;
+
+            // getters
+            public:
+
+                // member expressions
+                const std::tuple<Exprs...>& members() const noexcept { return m_members; }
+
+                // amount of elements
+                std::size_t size() const { return std::get<0>(m_members).size(); }
+
+                // [] overload to get (gather) the aggregate at a specific index
+                value_type operator [](std::size_t index) const {
+                    value_type out{};
+                    unroll<S::members>([&](auto k) { out.*std::get<k>(S::pointers) = std::get<k>(m_members)[index]; });
+                    return out;
+                }
+        };
+    };
+
+    /**
+    * \brief a struct of arrays collection, holding every listed data member of an aggregate in its own contiguous array,
+    *        i.e. - 'Lazy::Soa<Element, &Element::m_int, &Element::m_float, &Element::m_string> a(100)'
+    *
+    * @param {T,       in} aggregate (default constructible)
+    * @param {MEMBERS, in} pointers to the data members of T which are held
+    *
+    * \remarks a lazy container over a struct of arrays (i.e. - 'Lazy::Container<decltype(a)> lazy_a(a)') keeps the operator
+    *          syntax of its aggregate, while every member is evaluated by its own fused loop (arithmetic members in packets).
+    **/
+    template<typename T, auto... MEMBERS> class Soa {
+        static_assert(sizeof...(MEMBERS) > 0, "Soa<T, MEMBERS...>: no members.");
+        static_assert((std::is_same_v<typename detail::member_pointer<decltype(MEMBERS)>::class_type, T> && ...), "Soa<T, MEMBERS...>: MEMBERS must be data members of T.");
+
+        public:
+            //
+            // aliases
+            //
+            using value_type  = T;
+            using size_type   = std::size_t;
+            using arrays_type = std::tuple<std::vector<detail::member_t<MEMBERS>>...>;
+
+            // struct of arrays properties
+            static constexpr bool        is_soa  = true;
+            static constexpr std::size_t members = sizeof...(MEMBERS);
+            static constexpr auto        pointers{ std::make_tuple(MEMBERS...) };
+
+            //
+            // constructors
+            //
+
+            Soa() = default;
+
+            // a given amount of copies of an aggregate
+            explicit Soa(size_type xi_size, const T& xi_value = T{}) { resize(xi_size, xi_value); }
+
+            //
+            // access
+            //
+
+            // amount of elements
+            size_type size() const noexcept { return std::get<0>(m_arrays).size(); }
+
+            // array of member 'I'
+            template<std::size_t I> auto&       array()       noexcept { return std::get<I>(m_arrays); }
+            template<std::size_t I> const auto& array() const noexcept { return std::get<I>(m_arrays); }
+            arrays_type&                        arrays()      noexcept { return m_arrays; }
+
+            // get (gather) the aggregate at a specific index
+            T operator [](size_type i) const {
+                T out{};
+                detail::unroll<members>([&](auto k) { out.*std::get<k>(pointers) = std::get<k>(m_arrays)[i]; });
+                return out;
+            }
+
+            // set (scatter) the aggregate at a specific index
+            void set(size_type i, const T& xi_value) {
+                detail::unroll<members>([&](auto k) { std::get<k>(m_arrays)[i] = xi_value.*std::get<k>(pointers); });
+            }
+
+            // change the amount of elements (appended elements are copies of an aggregate)
+            void resize(size_type xi_size, const T& xi_value = T{}) {
+                detail::unroll<members>([&](auto k) { std::get<k>(m_arrays).resize(xi_size, xi_value.*std::get<k>(pointers)); });
+            }
+
+            // append an aggregate
+            void push_back(const T& xi_value) {
+                detail::unroll<members>([&](auto k) { std::get<k>(m_arrays).push_back(xi_value.*std::get<k>(pointers)); });
+            }
+
+        // properties
+        private:
+            arrays_type m_arrays;
+    };
+
+    /**
+    * \brief a lazy container over a struct of arrays: a lazy container per member array, with the operator syntax of the aggregate,
+    *        i.e. - 'lazy_d += lazy_a + lazy_b' evaluates one loop per member.
+    *
+    * @param {T,       in} aggregate
+    * @param {MEMBERS, in} pointers to the data members of T which are held
+    *
+    * \remarks operands are lazy structs of arrays (of the same members), aggregates (split into members) or scalars (broadcast to every member).
+    **/
+    template<typename T, auto... MEMBERS>
+    struct Container<Soa<T, MEMBERS...>> : public detail::SoaOperators<Soa<T, MEMBERS...>, Container<Soa<T, MEMBERS...>>> {
+        using collection_type = Soa<T, MEMBERS...>;
+        using value_type      = T;
+        using size_type       = std::size_t;
+        using members_type    = std::tuple<Container<std::vector<detail::member_t<MEMBERS>>>...>;
+
+        //
+        // constructors
+        //
+
+        Container(collection_type& xi_col) : m_members(std::apply([](auto&... arrays) { return members_type(arrays...); }, xi_col.arrays())) {}
+
+        // copy semantics (copy assignment evaluates the members of another container)
+        Container(const Container&) = default;
+        Container& operator =(const Container& xi_other) {
+            detail::unroll<collection_type::members>([&](auto k) { std::get<k>(m_members) = std::get<k>(xi_other.m_members); });
+            return *this;
+        }
+
+        //
+        // access
+        //
+
+        // lazy containers over member arrays
+        const members_type& members() const noexcept { return m_members; }
+
+        // amount of elements
+        size_type size() const { return std::get<0>(m_members).size(); }
+
+        // get (gather) the aggregate at a specific index
+        T operator [](size_type i) const {
+            T out{};
+            detail::unroll<collection_type::members>([&](auto k) { out.*std::get<k>(collection_type::pointers) = std::get<k>(m_members)[i]; });
+            return out;
+        }
+
+        //
+        // (compound) assignment, member by member
+        //
+
+#define M_OPERATOR_OVERLOAD(AOP)                                                                                                                                         \
+        template<typename R> Container& operator AOP (const R& xi_right) {                                                                                               \
+            detail::unroll<collection_type::members>([&](auto k) { std::get<k>(m_members) AOP detail::soa_member<decltype(k)::value, collection_type>(xi_right); });   \
+            return *this;                                                                                                                                                \
+        }
+
+        M_OPERATOR_OVERLOAD(=);
+        M_OPERATOR_OVERLOAD(+=);
+        M_OPERATOR_OVERLOAD(-=);
+        M_OPERATOR_OVERLOAD(*=);
+        M_OPERATOR_OVERLOAD(/=);
+
+#undef M_OPERATOR_OVERLOAD
+
+        // properties
+        private:
+            members_type m_members;
+    };
+
+    /**
+    * \brief the expression of member 'I' of a struct of arrays operand, i.e. - 'Lazy::sum(Lazy::member<1>(lazy_a + lazy_b))'
+    **/
+    template<std::size_t I, typename E, typename std::enable_if<detail::Concepts::is_soa_v<E>>::type* = nullptr>
+    const auto& member(const E& xi_operand) {
+        return std::get<I>(xi_operand.members());
+    }
+
+    namespace detail {
+
+        // default amount of bytes (per operand) of a batch evaluated by 'Lazy::for_each_batch'
+        constexpr std::size_t batch_bytes{ 1 << 20 };
+
+        /**
+        * \brief evaluate an index range of an expression into a buffer
+        *
+        * @param {xi_expression, in}  expression
+        * @param {xi_first,      in}  index of first element
+        * @param {xi_last,       in}  index one past the last element
+        * @param {xo_out,        out} buffer of (at least) 'xi_last - xi_first' elements, element 'i' is written at 'xo_out[i - xi_first]'
+        **/
+        template<typename E, typename T> void evaluate_into(const E& xi_expression, std::size_t xi_first, std::size_t xi_last, T* xo_out) {
+            std::size_t i{ xi_first };
+
+            if constexpr (Concepts::is_segmented_v<E>) {
+                for (auto c{ cursor(xi_expression, i) }; i < xi_last; ++i, ++c) {
+                    xo_out[i - xi_first] = *c;
+                }
+                return;
+            } else if constexpr (Simd::enabled && std::is_arithmetic_v<T> && std::decay_t<E>::is_vectorizable && std::is_same_v<typename std::decay_t<E>::value_type, T>) {
+                using packet_type = Simd::Packet<T>;
+                for (; i + packet_type::size <= xi_last; i += packet_type::size) {
+                    xi_expression.packet(i).store(xo_out + (i - xi_first));
+                }
+            }
+
+            for (; i < xi_last; ++i) {
+                xo_out[i - xi_first] = xi_expression[i];
+            }
+        }
+    };
+
+    /**
+    * \brief evaluate an expression batch by batch into a bounded buffer, handing every batch to a sink,
+    *        i.e. - 'Lazy::for_each_batch(lazy_a * lazy_b + lazy_c, Lazy::FileWriter<float>("out.bin"))'
+    *
+    * @param {xi_expression,  in} expression (with a bounded amount of elements)
+    * @param {xi_sink,        in} callable invoked (in index order) with (pointer to first element, amount of elements) of every batch
+    * @param {xi_batch_bytes, in} amount of bytes per batch
+    *
+    * \remarks before a batch is evaluated its operands are prepared (as under 'Lazy::tiled'), so file backed leaves read
+    *          the batch and mapped leaves are advised to read the following batch. memory use is bounded by one batch.
+    **/
+    template<typename E, typename Sink, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    void for_each_batch(const E& xi_expression, Sink&& xi_sink, std::size_t xi_batch_bytes = detail::batch_bytes) {
+        static_assert(detail::Concepts::is_bounded_v<E>, "Lazy::for_each_batch: an expression of broadcast scalars only has no amount of elements.");
+        using value_type = typename std::decay_t<E>::value_type;
+        const std::size_t len{ xi_expression.size() };
+        assert(len != detail::unbounded);
+
+        const std::size_t batch{ std::max<std::size_t>(1, std::min(len, xi_batch_bytes / sizeof(value_type))) };
+        std::vector<value_type> buffer(batch);
+
+        detail::Instrumentation::measure<detail::BinaryOperations::ASSIGN<value_type>, value_type>("batched", xi_expression, len, std::decay_t<E>::is_vectorizable,
+                                                                                                    [&xi_expression, &xi_sink, &buffer, len, batch] {
+            detail::prepare(xi_expression, 0, 0);
+            for (std::size_t first{}; first < len; first += batch) {
+                const std::size_t last{ std::min(first + batch, len) };
+                detail::prepare(xi_expression, first, last);
+                detail::evaluate_into(xi_expression, first, last, buffer.data());
+                xi_sink(static_cast<const value_type*>(buffer.data()), last - first);
+            }
+            detail::prepare(xi_expression, 0, 0);
+        });
+    }
+
+    namespace detail {
+        namespace Runtime {
+
+            // operations of a runtime expression graph (applied through the 'BinaryOperations' functors)
+            enum class Operation : char { add = '+', sub = '-', mul = '*', div = '/', land = '&', lor = '|', lxor = '^' };
+
+            /**
+            * \brief invoke a callable with the 'BinaryOperations' functor of an operation
+            *
+            * @param {T,            in}  element type
+            * @param {xi_operation, in}  operation
+            * @param {xi_function,  in}  callable invoked with a (default constructed) functor
+            * @param {return,       out} callable's return value
+            *
+            * \remarks '+' is defined over every element type (i.e. - strings), '-', '*' and '/' over arithmetic types, and bit operations over integral types.
+            **/
+            template<typename T, typename F> auto dispatch(Operation xi_operation, F&& xi_function) {
+                switch (xi_operation) {
+                    case Operation::add: return xi_function(BinaryOperations::ADD<T>{});
+                    case Operation::sub: if constexpr (std::is_arithmetic_v<T>) { return xi_function(BinaryOperations::SUB<T>{});  } break;
+                    case Operation::mul: if constexpr (std::is_arithmetic_v<T>) { return xi_function(BinaryOperations::MUL<T>{});  } break;
+                    case Operation::div: if constexpr (std::is_arithmetic_v<T>) { return xi_function(BinaryOperations::DIV<T>{});  } break;
+                    case Operation::land: if constexpr (std::is_integral_v<T>)  { return xi_function(BinaryOperations::LAND<T>{}); } break;
+                    case Operation::lor: if constexpr (std::is_integral_v<T>)   { return xi_function(BinaryOperations::LOR<T>{});  } break;
+                    case Operation::lxor: if constexpr (std::is_integral_v<T>)  { return xi_function(BinaryOperations::LXOR<T>{}); } break;
+                }
+                throw std::invalid_argument("Lazy::Dynamic: operation is not defined over element type.");
+            }
+
+            /**
+            * \brief a node of a runtime expression graph: a column (collection), a broadcast scalar or an operation over two nodes
+            **/
+            template<typename T> struct Node {
+                enum class Kind { column, scalar, operation };
+
+                Kind                          m_kind;
+                Operation                     m_operation{};
+                std::shared_ptr<const Node>   m_left{},
+                                              m_right{};
+                T                             m_scalar{};
+                std::function<const T*()>     m_data{};          // elements of a contiguous column (read as the column is evaluated)
+                std::function<T(std::size_t)> m_at{};            // element of a column
+                std::function<std::size_t()>  m_size{};          // amount of elements of a column (read as the graph is compiled)
+                Region                        m_region{};
+
+                // a broadcast scalar
+                explicit Node(T xi_scalar) : m_kind(Kind::scalar), m_scalar(std::move(xi_scalar)) {}
+
+                // an operation over two nodes
+                Node(Operation xi_operation, std::shared_ptr<const Node> xi_left, std::shared_ptr<const Node> xi_right) :
+                    m_kind(Kind::operation), m_operation(xi_operation), m_left(std::move(xi_left)), m_right(std::move(xi_right)) {}
+
+                // a column reading a lazy container (which must outlive the node)
+                template<typename COLLECTION> explicit Node(const Container<COLLECTION>& xi_column) :
+                    m_kind(Kind::column),
+                    m_at([&xi_column](std::size_t i) -> T { return xi_column[i]; }),
+                    m_size([&xi_column]() { return static_cast<std::size_t>(xi_column.size()); }),
+                    m_region(xi_column.region()) {
+                    if constexpr (Concepts::has_data_v<const COLLECTION>) {
+                        m_data = [&xi_column]() -> const T* { return xi_column.collection().data(); };
+                    }
+                }
+
+                // amount of elements (a scalar is broadcast)
+                std::size_t size() const { return m_size ? m_size() : unbounded; }
+            };
+
+            // a kernel evaluates 'count' elements of an instruction out of its input buffers
+            template<typename T> using kernel_type = void (*)(const T* const* xi_in, T* xo_out, std::size_t xi_count);
+
+            // kernel of 'in[0] OP in[1]'
+            template<typename T, typename Op> void kernel(const T* const* xi_in, T* xo_out, std::size_t xi_count) {
+                std::size_t i{};
+                if constexpr (Simd::enabled && Concepts::has_packet_apply_v<Op, T>) {
+                    using packet_type = Simd::Packet<T>;
+                    for (; i + packet_type::size <= xi_count; i += packet_type::size) {
+                        Op::apply(packet_type::load(xi_in[0] + i), packet_type::load(xi_in[1] + i)).store(xo_out + i);
+                    }
+                }
+                for (; i < xi_count; ++i) {
+                    xo_out[i] = Op::apply(xi_in[0][i], xi_in[1][i]);
+                }
+            }
+
+            // fused kernel of '(in[0] INNER in[1]) OUTER in[2]' (or 'in[0] OUTER (in[1] INNER in[2])' if the nested operation is on the right)
+            template<typename T, typename Inner, typename Outer, bool LEFT> void fused_kernel(const T* const* xi_in, T* xo_out, std::size_t xi_count) {
+                const auto apply = [](const auto& a, const auto& b, const auto& c) {
+                    if constexpr (LEFT) {
+                        return Outer::apply(Inner::apply(a, b), c);
+                    } else {
+                        return Outer::apply(a, Inner::apply(b, c));
+                    }
+                };
+
+                std::size_t i{};
+                if constexpr (Simd::enabled && Concepts::has_packet_apply_v<Inner, T> && Concepts::has_packet_apply_v<Outer, T>) {
+                    using packet_type = Simd::Packet<T>;
+                    for (; i + packet_type::size <= xi_count; i += packet_type::size) {
+                        apply(packet_type::load(xi_in[0] + i), packet_type::load(xi_in[1] + i), packet_type::load(xi_in[2] + i)).store(xo_out + i);
+                    }
+                }
+                for (; i < xi_count; ++i) {
+                    xo_out[i] = apply(xi_in[0][i], xi_in[1][i], xi_in[2][i]);
+                }
+            }
+
+            /**
+            * \brief a compiled runtime expression: a sequence of (pre instantiated) kernels over buffers.
+            *
+            * \remarks buffers [0, leaves) are the leaves (in the order they are first met), the following are registers.
+            **/
+            template<typename T> struct Program {
+                struct Instruction {
+                    kernel_type<T>             m_kernel;
+                    std::array<std::size_t, 3> m_in;
+                    std::size_t                m_out;
+                };
+
+                std::vector<Instruction> m_instructions;
+                std::size_t              m_leaves{};
+                std::size_t              m_result{};
+            };
+
+            // the leaves of a graph (first met order) and its shape, i.e. - '((0*1)+0)'
+            template<typename T> void shape(const Node<T>& xi_node, std::vector<const Node<T>*>& xo_leaves, std::string& xo_shape) {
+                if (xi_node.m_kind != Node<T>::Kind::operation) {
+                    const auto it{ std::find(xo_leaves.begin(), xo_leaves.end(), &xi_node) };
+                    xo_shape += std::to_string(static_cast<std::size_t>(it - xo_leaves.begin()));
+                    if (it == xo_leaves.end()) {
+                        xo_leaves.push_back(&xi_node);
+                    }
+                    return;
+                }
+
+                xo_shape += '(';
+                shape(*xi_node.m_left, xo_leaves, xo_shape);
+                xo_shape += static_cast<char>(xi_node.m_operation);
+                shape(*xi_node.m_right, xo_leaves, xo_shape);
+                xo_shape += ')';
+            }
+
+            // compile a graph node into a program, returning the buffer holding it
+            template<typename T> std::size_t compile(const Node<T>& xi_node, const std::vector<const Node<T>*>& xi_leaves, Program<T>& xo_program) {
+                using kind = typename Node<T>::Kind;
+                if (xi_node.m_kind != kind::operation) {
+                    return static_cast<std::size_t>(std::find(xi_leaves.begin(), xi_leaves.end(), &xi_node) - xi_leaves.begin());
+                }
+
+                // an operation over a nested operation is evaluated by a fused kernel of both
+                const Node<T>& left{ *xi_node.m_left };
+                const Node<T>& right{ *xi_node.m_right };
+                typename Program<T>::Instruction instruction{};
+                if ((left.m_kind == kind::operation) || (right.m_kind == kind::operation)) {
+                    const bool      nested_left{ left.m_kind == kind::operation };
+                    const Node<T>&  nested{ nested_left ? left : right };
+                    const std::size_t a{ nested_left ? compile(*nested.m_left, xi_leaves, xo_program) : compile(left, xi_leaves, xo_program) },
+                                      b{ nested_left ? compile(*nested.m_right, xi_leaves, xo_program) : compile(*nested.m_left, xi_leaves, xo_program) },
+                                      c{ nested_left ? compile(right, xi_leaves, xo_program) : compile(*nested.m_right, xi_leaves, xo_program) };
+                    instruction.m_in     = { a, b, c };
+                    instruction.m_kernel = dispatch<T>(nested.m_operation, [&xi_node, nested_left](auto inner) {
+                        return dispatch<T>(xi_node.m_operation, [nested_left](auto outer) {
+                            return nested_left ? &fused_kernel<T, decltype(inner), decltype(outer), true> : &fused_kernel<T, decltype(inner), decltype(outer), false>;
+                        });
+                    });
+                } else {
+                    instruction.m_in     = { compile(left, xi_leaves, xo_program), compile(right, xi_leaves, xo_program), 0 };
+                    instruction.m_kernel = dispatch<T>(xi_node.m_operation, [](auto op) { return &kernel<T, decltype(op)>; });
+                }
+
+                instruction.m_out = xo_program.m_leaves + xo_program.m_instructions.size();
+                xo_program.m_instructions.push_back(instruction);
+                return instruction.m_out;
+            }
+
+            // the compiled programs of an element type, by shape
+            template<typename T> struct Programs {
+                std::mutex                                                        m_mutex;
+                std::unordered_map<std::string, std::shared_ptr<const Program<T>>> m_programs;
+
+                static Programs& instance() {
+                    static Programs programs;
+                    return programs;
+                }
+            };
+
+            /**
+            * \brief the compiled program of a graph shape, compiled once per shape (and element type)
+            *
+            * @param {xi_root,   in}  graph
+            * @param {xo_leaves, out} leaves of graph, in the order the program reads them
+            * @param {return,    out} compiled program
+            **/
+            template<typename T> std::shared_ptr<const Program<T>> program(const Node<T>& xi_root, std::vector<const Node<T>*>& xo_leaves) {
+                std::string key;
+                shape(xi_root, xo_leaves, key);
+
+                Programs<T>& programs{ Programs<T>::instance() };
+                std::lock_guard<std::mutex> lock(programs.m_mutex);
+                std::shared_ptr<const Program<T>>& out{ programs.m_programs[key] };
+                if (!out) {
+                    std::shared_ptr<Program<T>> compiled(std::make_shared<Program<T>>());
+                    compiled->m_leaves = xo_leaves.size();
+                    compiled->m_result = compile(xi_root, xo_leaves, *compiled);
+                    out = std::move(compiled);
+                }
+                return out;
+            }
+
+            // amount of shapes compiled for an element type
+            template<typename T> std::size_t compiled() {
+                Programs<T>& programs{ Programs<T>::instance() };
+                std::lock_guard<std::mutex> lock(programs.m_mutex);
+                return programs.m_programs.size();
+            }
+        }
+
+        /**
+        * \brief the (leaf) expression of a compiled runtime graph (see 'Lazy::compile')
+        *
+        * @param {T, in} element type
+        *
+        * \remarks arithmetic elements are evaluated batch at a time: a batch of every leaf is read (contiguous columns are read in place,
+        *          and other columns are gathered), and kernels write its operations into register buffers. an element outside the
+        *          evaluated batch evaluates the batch starting at it, so the expression is stateful (evaluated by a single thread).
+        *          other elements (i.e. - strings) are interpreted element by element.
+        **/
+        template<typename T> class DynamicExpression : public ExpressionOperators<DynamicExpression<T>> {
+
+            // aliases
+            public:
+                using value_type = T;
+
+            // properties
+            private:
+                using node_type = Runtime::Node<T>;
+                using kind      = typename node_type::Kind;
+
+                // amount of elements per batch (of every buffer)
+                static constexpr std::size_t batch{ std::max<std::size_t>(tile_bytes / sizeof(T), 1) };
+
+                std::shared_ptr<const node_type>          m_root;
+                std::vector<const node_type*>             m_leaves;
+                std::shared_ptr<const Runtime::Program<T>> m_program;
+                std::size_t                               m_size{ unbounded };
+                mutable std::vector<T>                    m_buffers;             // a batch of every leaf (broadcast scalars and gathered columns) and register
+                mutable std::vector<const T*>             m_inputs;              // batch of every buffer
+                mutable const T*                          m_result{ nullptr };
+                mutable std::size_t                       m_first{};
+                mutable std::size_t                       m_count{};
+
+            // constructors
+            public:
+                // prohibit empty constructor
+                DynamicExpression() = delete;
+
+                // compile a graph
+                explicit DynamicExpression(std::shared_ptr<const node_type> xi_root) : m_root(std::move(xi_root)) {
+                    if constexpr (std::is_arithmetic_v<T>) {
+                        m_program = Runtime::program(*m_root, m_leaves);
+                        const std::size_t buffers{ m_program->m_leaves + m_program->m_instructions.size() };
+                        m_buffers.resize(buffers * batch);
+                        m_inputs.resize(buffers);
+                        for (std::size_t i{}; i < m_leaves.size(); ++i) {
+                            if (m_leaves[i]->m_kind == kind::scalar) {
+                                std::fill_n(m_buffers.begin() + i * batch, batch, m_leaves[i]->m_scalar);
+                            }
+                        }
+                    } else {
+                        std::string key;
+                        Runtime::shape(*m_root, m_leaves, key);
+                    }
+
+                    for (const node_type* leaf : m_leaves) {
+                        assert(matching_size(m_size, leaf->size()));
+                        m_size = std::min(m_size, leaf->size());
+                    }
+                }
+
+                // a copy evaluates its own batches
+                DynamicExpression(const DynamicExpression& xi_other) : m_root(xi_other.m_root), m_leaves(xi_other.m_leaves), m_program(xi_other.m_program), m_size(xi_other.m_size),
+                                                                      m_buffers(xi_other.m_buffers), m_inputs(xi_other.m_inputs.size()) {}
+                DynamicExpression(DynamicExpression&&) noexcept = default;
+
+            // getters
+            public:
+
+                // amount of elements
+                std::size_t size() const noexcept { return m_size; }
+
+                // batches are evaluated ahead of the destination, so a graph reading the destination is evaluated through a scratch buffer
+                static constexpr bool is_elementwise = false;
+                Alias alias(const Region& xi_destination) const noexcept {
+                    for (const node_type* leaf : m_leaves) {
+                        if ((leaf->m_kind == kind::column) && (detail::alias(leaf->m_region, xi_destination) != Alias::none)) {
+                            return Alias::unknown;
+                        }
+                    }
+                    return Alias::none;
+                }
+
+                // evaluation keeps the evaluated batch
+                static constexpr bool is_stateful = std::is_arithmetic_v<T>;
+
+                // prepare evaluation of an index range (evaluate its first batch, or discard the evaluated batch if it is empty)
+                void prepare(std::size_t xi_first, std::size_t xi_last) const {
+                    if constexpr (std::is_arithmetic_v<T>) {
+                        if (xi_first >= xi_last) {
+                            m_count = 0;
+                        } else if ((xi_first < m_first) || (xi_first >= m_first + m_count)) {
+                            evaluate(xi_first);
+                        }
+                    }
+                }
+
+                // [] overload to get element at a specific index
+                T operator [](std::size_t index) const {
+                    if constexpr (std::is_arithmetic_v<T>) {
+                        if (index - m_first >= m_count) {
+                            evaluate(index);
+                        }
+                        return m_result[index - m_first];
+                    } else {
+                        return interpret(*m_root, index);
+                    }
+                }
+
+                // can expression be evaluated in packets?
+                static constexpr bool is_vectorizable = Simd::enabled && std::is_arithmetic_v<T>;
+
+                // get packet starting at a specific index
+                Simd::Packet<T> packet(std::size_t index) const {
+                    using packet_type = Simd::Packet<T>;
+                    if ((index < m_first) || (index + packet_type::size > m_first + m_count)) {
+                        evaluate(index);
+                    }
+                    return packet_type::load(m_result + (index - m_first));
+                }
+
+                // is expression evaluated by a compiled program?
+                bool is_compiled() const noexcept { return static_cast<bool>(m_program); }
+
+            // internal
+            private:
+
+                // evaluate the batch starting at a given index
+                void evaluate(std::size_t xi_first) const {
+                    m_first = xi_first;
+                    m_count = std::min(batch, m_size - xi_first);
+
+                    for (std::size_t i{}; i < m_leaves.size(); ++i) {
+                        const node_type& leaf{ *m_leaves[i] };
+                        T* buffer{ m_buffers.data() + i * batch };
+                        if (leaf.m_kind == kind::scalar) {
+                            m_inputs[i] = buffer;
+                        } else if (leaf.m_data) {
+                            m_inputs[i] = leaf.m_data() + xi_first;
+                        } else {
+                            for (std::size_t j{}; j < m_count; ++j) {
+                                buffer[j] = leaf.m_at(xi_first + j);
+                            }
+                            m_inputs[i] = buffer;
+                        }
+                    }
+
+                    for (const auto& instruction : m_program->m_instructions) {
+                        const T* in[3]{ m_inputs[instruction.m_in[0]], m_inputs[instruction.m_in[1]], m_inputs[instruction.m_in[2]] };
+                        T* out{ m_buffers.data() + instruction.m_out * batch };
+                        instruction.m_kernel(in, out, m_count);
+                        m_inputs[instruction.m_out] = out;
+                    }
+                    m_result = m_inputs[m_program->m_result];
+                }
+
+                // interpret a graph node at a specific index
+                static T interpret(const node_type& xi_node, std::size_t xi_index) {
+                    switch (xi_node.m_kind) {
+                        case kind::scalar: return xi_node.m_scalar;
+                        case kind::column: return xi_node.m_at(xi_index);
+                        default:           return Runtime::dispatch<T>(xi_node.m_operation, [&xi_node, xi_index](auto op) -> T {
+                                               return decltype(op)::apply(interpret(*xi_node.m_left, xi_index), interpret(*xi_node.m_right, xi_index));
+                                           });
+                    }
+                }
+        };
+    };
+
+    /**
+    * \brief an expression graph built at runtime, i.e. - 'Lazy::Dynamic<float> e{ Lazy::column(lazy_a) }; if (scale) { e = e * 2.0f; } lazy_d = Lazy::compile(e + Lazy::column(lazy_b));'
+    *
+    * @param {T, in} element type
+    *
+    * \remarks a graph holds its nodes (shared between the graphs built from them) and refers to its columns, which must outlive it.
+    **/
+    template<typename T> class Dynamic {
+
+        // aliases
+        public:
+            using value_type = T;
+
+        // properties
+        private:
+            using node_type = detail::Runtime::Node<T>;
+            std::shared_ptr<const node_type> m_root;
+
+        // constructors
+        public:
+            // a broadcast scalar
+            Dynamic(T xi_scalar) : m_root(std::make_shared<const node_type>(std::move(xi_scalar))) {}
+
+            // a graph node
+            explicit Dynamic(std::shared_ptr<const node_type> xi_root) noexcept : m_root(std::move(xi_root)) {}
+
+        // getters
+        public:
+            const std::shared_ptr<const node_type>& root() const noexcept { return m_root; }
+
+            //
+            // operator overloading
+            //
+
+#define M_OPERATOR_OVERLOAD(OP, NAME)                                                                                                                   \
+            friend Dynamic operator OP (const Dynamic& xi_left, const Dynamic& xi_right) {                                                              \
+                return Dynamic(std::make_shared<const node_type>(detail::Runtime::Operation::NAME, xi_left.m_root, xi_right.m_root));                   \
+            }
+
+            M_OPERATOR_OVERLOAD(+, add);
+            M_OPERATOR_OVERLOAD(-, sub);
+            M_OPERATOR_OVERLOAD(*, mul);
+            M_OPERATOR_OVERLOAD(/, div);
+            M_OPERATOR_OVERLOAD(&, land);
+            M_OPERATOR_OVERLOAD(|, lor);
+            M_OPERATOR_OVERLOAD(^, lxor);
+
+#undef M_OPERATOR_OVERLOAD
+    };
+
+    /**
+    * \brief a runtime graph column reading a lazy container
+    *
+    * @param {xi_column, in}  container (must outlive the graph)
+    * @param {return,    out} graph
+    *
+    * \remarks the container is read as the graph is compiled and evaluated, so a collection resized after the graph was built is read as it is then.
+    **/
+    template<typename COLLECTION> Dynamic<typename Container<COLLECTION>::value_type> column(const Container<COLLECTION>& xi_column) {
+        using value_type = typename Container<COLLECTION>::value_type;
+        return Dynamic<value_type>(std::make_shared<const detail::Runtime::Node<value_type>>(xi_column));
+    }
+
+    /**
+    * \brief compile a runtime graph into an expression, i.e. - 'lazy_d = Lazy::compile(graph) * lazy_c'
+    *
+    * @param {xi_graph, in}  graph
+    * @param {return,   out} expression
+    *
+    * \remarks arithmetic graphs are compiled into programs of fused kernels, cached by the shape of the graph, so a graph of a known shape is compiled once.
+    **/
+    template<typename T> detail::DynamicExpression<T> compile(const Dynamic<T>& xi_graph) {
+        return detail::DynamicExpression<T>(xi_graph.root());
+    }
+
+    namespace detail {
+
+        /**
+        * \brief a set of disjoint (and not adjacent) index ranges [first, last), ordered by their first index
+        **/
+        class Intervals {
+            // aliases
+            public:
+                using range_type = std::pair<std::size_t, std::size_t>;
+
+            // properties
+            private:
+                std::vector<range_type> m_ranges;
+
+            // methods
+            public:
+
+                // add a range (merged with the ranges it overlaps or touches)
+                void insert(std::size_t xi_first, std::size_t xi_last) {
+                    if (xi_first >= xi_last) {
+                        return;
+                    }
+                    auto first{ std::lower_bound(m_ranges.begin(), m_ranges.end(), xi_first, [](const range_type& xi_range, std::size_t xi_index) { return xi_range.second < xi_index; }) };
+                    auto last{ first };
+                    for (; (last != m_ranges.end()) && (last->first <= xi_last); ++last) {
+                        xi_first = std::min(xi_first, last->first);
+                        xi_last  = std::max(xi_last, last->second);
+                    }
+                    m_ranges.insert(m_ranges.erase(first, last), range_type{ xi_first, xi_last });
+                }
+
+                // add the ranges of another set
+                void insert(const Intervals& xi_other) {
+                    for (const range_type& range : xi_other.m_ranges) {
+                        insert(range.first, range.second);
+                    }
+                }
+
+                void clear() noexcept { m_ranges.clear(); }
+
+            // getters
+            public:
+                const std::vector<range_type>& ranges() const noexcept { return m_ranges; }
+                bool empty() const noexcept { return m_ranges.empty(); }
+
+                // amount of indices in set
+                std::size_t count() const noexcept {
+                    std::size_t out{};
+                    for (const range_type& range : m_ranges) {
+                        out += range.second - range.first;
+                    }
+                    return out;
+                }
+        };
+    }
+
+    /**
+    * \brief a container (leaf) which records the index ranges modified through it, i.e. - 'Lazy::Tracked<decltype(a)> tracked_a(lazy_a); tracked_a.set(7, 1.0f);'
+    *
+    * @param {COLLECTION, in} wrapped collection type
+    *
+    * \remarks changes are read (and discarded) by the incremental evaluation of an expression holding the container (see 'Lazy::incremental'),
+    *          so a tracked container should be held by a single incremental evaluation. elements modified directly through the
+    *          (wrapped) container are recorded by marking their range.
+    **/
+    template<typename COLLECTION> class Tracked : public detail::ExpressionOperators<Tracked<COLLECTION>> {
+
+        // aliases
+        public:
+            using value_type = typename Container<COLLECTION>::value_type;
+
+        // properties
+        private:
+            Container<COLLECTION>&     m_container;
+            mutable detail::Intervals  m_dirty;
+
+        // constructors
+        public:
+            explicit Tracked(Container<COLLECTION>& xi_container) noexcept : m_container(xi_container) {}
+
+            Tracked(const Tracked&)             = delete;
+            Tracked& operator =(const Tracked&) = delete;
+
+        // setters
+        public:
+
+            // set element at a specific index
+            template<typename T> void set(std::size_t xi_index, T&& xi_value) {
+                m_container[xi_index] = std::forward<T>(xi_value);
+                m_dirty.insert(xi_index, xi_index + 1);
+            }
+
+            // record a modified index range
+            void mark(std::size_t xi_first, std::size_t xi_last) {
+                m_dirty.insert(xi_first, std::min(xi_last, size()));
+            }
+
+            // index ranges modified since changes were last discarded, and discard them (done by an incremental evaluation reading them)
+            const detail::Intervals& dirty() const noexcept { return m_dirty; }
+            void clean() const noexcept { m_dirty.clear(); }
+
+        // getters
+        public:
+
+            // amount of elements (and compile time amount of elements)
+            std::size_t size() const { return static_cast<std::size_t>(m_container.size()); }
+            static constexpr std::size_t extent = Container<COLLECTION>::extent;
+
+            // aliasing with destination
+            static constexpr bool is_elementwise = Container<COLLECTION>::is_elementwise;
+            detail::Alias alias(const detail::Region& xi_destination) const noexcept { return m_container.alias(xi_destination); }
+
+            // prepare evaluation of an index range
+            void prepare(std::size_t xi_first, std::size_t xi_last) const { m_container.prepare(xi_first, xi_last); }
+
+            // [] overload to get element at a specific index
+            decltype(auto) operator [](std::size_t index) const { return static_cast<const Container<COLLECTION>&>(m_container)[index]; }
+
+            // can expression be evaluated in packets?
+            static constexpr bool is_vectorizable = Container<COLLECTION>::is_vectorizable;
+
+            // get packet starting at a specific index
+            detail::Simd::Packet<value_type> packet(std::size_t index) const { return m_container.packet(index); }
+
+            // is tracked collection traversed by its iterators?
+            static constexpr bool is_segmented = Container<COLLECTION>::is_segmented;
+
+            // get a cursor starting at a specific index
+            auto cursor(std::size_t index) const { return m_container.cursor(index); }
+    };
+
+    namespace detail {
+
+        namespace Concepts {
+            // test if an expression holds operands (which might be tracked leaves), i.e. - a node or a cache
+            template<typename T, typename = void> struct has_operand                                                                         : std::false_type {};
+            template<typename T>                  struct has_operand<T, std::void_t<decltype(std::declval<const T&>().e())>>                 : std::true_type  {};
+            template<typename T, typename = void> struct has_left_operand                                                                    : std::false_type {};
+            template<typename T>                  struct has_left_operand<T, std::void_t<decltype(std::declval<const T&>().le())>>           : std::true_type  {};
+            template<typename T, typename = void> struct has_operand_tuple                                                                   : std::false_type {};
+            template<typename T>                  struct has_operand_tuple<T, std::void_t<decltype(std::declval<const T&>().operands())>>    : std::true_type  {};
+            template<typename T> constexpr bool has_operands_v = has_operand<T>::value || has_left_operand<T>::value || has_operand_tuple<T>::value;
+        }
+
+        // the index ranges modified in the tracked leaves of an expression (and discard them)
+        template<typename E> void changes(const E&, Intervals&, bool) noexcept {
+            static_assert(!Concepts::has_operands_v<E>, "Lazy::incremental: tracked leaves can not be found in the operands of this expression.");
+        }
+        template<typename C>                         void changes(const Tracked<C>& xi_leaf, Intervals& xo_changes, bool xi_clean);
+        template<typename E, typename U>             void changes(const UnaryExpression<E, U>& xi_expression, Intervals& xo_changes, bool xi_clean);
+        template<typename L, typename B, typename R> void changes(const BinaryExpression<L, B, R>& xi_expression, Intervals& xo_changes, bool xi_clean);
+        template<typename C, typename T, typename E> void changes(const WhereExpression<C, T, E>& xi_expression, Intervals& xo_changes, bool xi_clean);
+        template<typename F, typename... Exprs>      void changes(const MapExpression<F, Exprs...>& xi_expression, Intervals& xo_changes, bool xi_clean);
+        template<typename T, typename B, typename... Exprs> void changes(const ChainExpression<T, B, Exprs...>& xi_expression, Intervals& xo_changes, bool xi_clean);
+        template<typename E>                         void changes(const CacheExpression<E>& xi_expression, Intervals& xo_changes, bool xi_clean);
+
+        template<typename C> void changes(const Tracked<C>& xi_leaf, Intervals& xo_changes, bool xi_clean) {
+            xo_changes.insert(xi_leaf.dirty());
+            if (xi_clean) {
+                xi_leaf.clean();
+            }
+        }
+
+        template<typename E, typename U> void changes(const UnaryExpression<E, U>& xi_expression, Intervals& xo_changes, bool xi_clean) {
+            changes(xi_expression.e(), xo_changes, xi_clean);
+        }
+
+        template<typename L, typename B, typename R> void changes(const BinaryExpression<L, B, R>& xi_expression, Intervals& xo_changes, bool xi_clean) {
+            changes(xi_expression.le(), xo_changes, xi_clean);
+            changes(xi_expression.re(), xo_changes, xi_clean);
+        }
+
+        template<typename C, typename T, typename E> void changes(const WhereExpression<C, T, E>& xi_expression, Intervals& xo_changes, bool xi_clean) {
+            changes(xi_expression.ce(), xo_changes, xi_clean);
+            changes(xi_expression.te(), xo_changes, xi_clean);
+            changes(xi_expression.ee(), xo_changes, xi_clean);
+        }
+
+        template<typename F, typename... Exprs> void changes(const MapExpression<F, Exprs...>& xi_expression, Intervals& xo_changes, bool xi_clean) {
+            std::apply([&xo_changes, xi_clean](const auto&... operands) { (changes(operands, xo_changes, xi_clean), ...); }, xi_expression.operands());
+        }
+
+        template<typename T, typename B, typename... Exprs> void changes(const ChainExpression<T, B, Exprs...>& xi_expression, Intervals& xo_changes, bool xi_clean) {
+            std::apply([&xo_changes, xi_clean](const auto&... operands) { (changes(operands, xo_changes, xi_clean), ...); }, xi_expression.operands());
+        }
+
+        template<typename E> void changes(const CacheExpression<E>& xi_expression, Intervals& xo_changes, bool xi_clean) {
+            changes(xi_expression.e(), xo_changes, xi_clean);
+        }
+    }
+
+    /**
+    * \brief an assignment of a (stored) expression into a lazy container which re-evaluates only the indices modified (in its tracked leaves) since
+    *        it was last evaluated, i.e. - 'auto inc = Lazy::incremental(lazy_d, tracked_a * lazy_b); tracked_a.set(7, 1.0f); inc.refresh();'
+    *
+    * @param{COLLECTION} the collection wrapped by the destination container.
+    *
+    * \remarks an expression element must only depend on the elements of its (tracked) leaves at the same index, and must not read the destination.
+    *          leaves which are not tracked are assumed to be unchanged.
+    **/
+    template<typename COLLECTION> class Incremental {
+        public:
+            using value_type = typename Container<COLLECTION>::value_type;
+
+            //
+            // constructors
+            //
+
+            // bind (and evaluate) an expression
+            template<typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+            Incremental(Container<COLLECTION>& xi_destination, E&& xi_expression) : m_destination(xi_destination) {
+                using owned_type = detail::Owned<detail::operand_t<E, value_type>>;
+
+                std::shared_ptr<owned_type> expression(new owned_type{ detail::operand<value_type>(std::forward<E>(xi_expression)) });
+                assert(expression->m_expression.alias(xi_destination.region()) == detail::Alias::none);
+
+                m_changes  = [expression](detail::Intervals& xo_changes) { detail::changes(expression->m_expression, xo_changes, true); };
+                m_evaluate = [expression, &xi_destination](std::size_t xi_first, std::size_t xi_last) {
+                    using assign_type = detail::BinaryOperations::ASSIGN<value_type>;
+                    const auto& e{ expression->m_expression };
+                    detail::Instrumentation::measure<assign_type, value_type>("incremental", e, xi_last - xi_first,
+                                                                              Container<COLLECTION>::is_vectorizable && std::decay_t<decltype(e)>::is_vectorizable,
+                                                                              [&xi_destination, &e, xi_first, xi_last] {
+                        if ((xi_first == 0) && (xi_last >= static_cast<std::size_t>(xi_destination.size()))) {
+                            xi_destination.template assign<assign_type>(e);
+                        } else {
+                            detail::prepare(e, xi_first, xi_last);
+                            xi_destination.template evaluate<assign_type>(detail::flattened(e), xi_first, xi_last);
+                            detail::prepare(e, 0, 0);
+                        }
+                    });
+                };
+                refresh(true);
+            }
+
+        // methods
+        public:
+
+            /**
+            * \brief re-evaluate the indices modified since the expression was last evaluated
+            *
+            * @param {xi_all, in}  re-evaluate all indices?
+            * @param {return, out} amount of evaluated indices
+            **/
+            std::size_t refresh(bool xi_all = false) {
+                m_changes(m_dirty);
+                const std::size_t len{ static_cast<std::size_t>(m_destination.size()) };
+                if (xi_all) {
+                    m_dirty.clear();
+                    m_dirty.insert(0, len);
+                }
+
+                std::size_t count{};
+                for (const auto& range : m_dirty.ranges()) {
+                    const std::size_t last{ std::min(range.second, len) };
+                    if (range.first < last) {
+                        m_evaluate(range.first, last);
+                        count += last - range.first;
+                    }
+                }
+                m_dirty.clear();
+                return count;
+            }
+
+        // properties
+        private:
+            Container<COLLECTION>&                            m_destination;
+            detail::Intervals                                 m_dirty;
+            std::function<void(detail::Intervals&)>           m_changes;
+            std::function<void(std::size_t, std::size_t)>    m_evaluate;
+    };
+
+    /**
+    * \brief bind (and evaluate) an expression into a lazy container, to be re-evaluated over the indices modified in its tracked leaves (see 'Lazy::Tracked'),
+    *        i.e. - 'auto inc = Lazy::incremental(lazy_d, tracked_a * lazy_b + 1.0f); ... inc.refresh();'
+    *
+    * @param {xi_destination, in}  destination container
+    * @param {xi_expression,  in}  expression (nodes are held by value, and leaves by reference)
+    * @param {return,         out} incremental assignment
+    **/
+    template<typename COLLECTION, typename E, typename std::enable_if<detail::Concepts::is_expression_v<E>>::type* = nullptr>
+    Incremental<COLLECTION> incremental(Container<COLLECTION>& xi_destination, E&& xi_expression) {
+        return Incremental<COLLECTION>(xi_destination, std::forward<E>(xi_expression));
+    }
+
+#if defined(MAKELAZY_INSTRUMENTATION)
+    /**
+    * instrumentation of assignments, i.e. - 'Lazy::Instrumentation::set_sink([](const Lazy::Instrumentation::Record& r) { metrics.push(r.shape, r.nanoseconds); })'
+    **/
+    namespace Instrumentation {
+
+        // a record of an assignment
+        using Record = detail::Instrumentation::Record;
+
+        /**
+        * \brief install the sink every (outermost) assignment is recorded in (an empty sink disables recording)
+        *
+        * @param {xi_sink, in} callable invoked with the record of an assignment (calls are serialized)
+        **/
+        inline void set_sink(std::function<void(const Record&)> xi_sink) {
+            detail::Instrumentation::Hooks& hooks{ detail::Instrumentation::Hooks::instance() };
+            std::lock_guard<std::mutex> lock(hooks.m_mutex);
+            hooks.m_enabled.store(static_cast<bool>(xi_sink), std::memory_order_relaxed);
+            hooks.m_sink = std::move(xi_sink);
+        }
+
+        /**
+        * \brief install a counter of (process wide) allocations, sampled around assignments of heap owning elements (i.e. - strings)
+        *
+        * @param {xi_counter, in} callable returning the amount of allocations so far (i.e. - counted by a replaced 'operator new')
+        **/
+        inline void set_allocation_counter(std::function<std::uint64_t()> xi_counter) {
+            detail::Instrumentation::Hooks& hooks{ detail::Instrumentation::Hooks::instance() };
+            std::lock_guard<std::mutex> lock(hooks.m_mutex);
+            hooks.m_allocations = std::move(xi_counter);
+        }
+    }
+#endif
+
+#if defined(MAKELAZY_MMAP)
+    namespace detail {
+
+        // size (in bytes) of a memory page
+        inline std::size_t page_size() noexcept {
+            static const std::size_t size{ static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)) };
+            return size;
+        }
+
+        // throw the error of the last failing system call
+        [[noreturn]] inline void throw_system_error(const char* xi_what) {
+            throw std::system_error(errno, std::generic_category(), xi_what);
+        }
+
+        // owner of a file descriptor
+        class FileDescriptor {
+            // properties
+            private:
+                int m_fd;
+
+            public:
+                FileDescriptor(const char* xi_path, int xi_flags) : m_fd(::open(xi_path, xi_flags | O_CLOEXEC, 0644)) {
+                    if (m_fd < 0) {
+                        throw_system_error(xi_path);
+                    }
+                }
+                ~FileDescriptor() {
+                    if (m_fd >= 0) {
+                        ::close(m_fd);
+                    }
+                }
+
+                FileDescriptor(const FileDescriptor&)             = delete;
+                FileDescriptor& operator =(const FileDescriptor&) = delete;
+
+                // a moved descriptor is closed by its new owner
+                FileDescriptor(FileDescriptor&& xi_file) noexcept : m_fd(std::exchange(xi_file.m_fd, -1)) {}
+
+                // size of file (in bytes)
+                std::size_t bytes() const {
+                    struct stat status;
+                    if (::fstat(m_fd, &status) != 0) {
+                        throw_system_error("fstat");
+                    }
+                    return static_cast<std::size_t>(status.st_size);
+                }
+
+                int get() const noexcept { return m_fd; }
+        };
+    };
+
+    /**
+    * \brief a binary file of trivially copyable elements, memory mapped as a contiguous collection which can be wrapped by 'Lazy::Container',
+    *        i.e. - 'Lazy::MappedFile<float> a("a.bin"); Lazy::Container<decltype(a)> lazy_a(a);'
+    *
+    * @param {T, in} element type
+    *
+    * \remarks pages are read on demand, so files larger than memory are evaluated in bounded (resident) memory.
+    *          evaluation advises the kernel to read ahead the range following every prepared range (see 'Lazy::tiled').
+    *          a file mapped for reading must not be assigned to.
+    **/
+    template<typename T> class MappedFile {
+        static_assert(std::is_trivially_copyable_v<T>, "MappedFile<T>: T must be trivially copyable.");
+
+        public:
+            //
+            // aliases
+            //
+            using value_type             = T;
+            using size_type              = std::size_t;
+            using difference_type        = std::ptrdiff_t;
+            using reference              = T&;
+            using const_reference        = const T&;
+            using pointer                = T*;
+            using const_pointer          = const T*;
+            using iterator               = T*;
+            using const_iterator         = const T*;
+            using reverse_iterator       = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+            //
+            // constructors
+            //
+
+            // map an existing file for reading
+            explicit MappedFile(const char* xi_path) {
+                const detail::FileDescriptor file(xi_path, O_RDONLY);
+                map(file, file.bytes() / sizeof(T), PROT_READ);
+            }
+
+            // create (or truncate) a file of a given amount of elements, mapped for reading and writing
+            MappedFile(const char* xi_path, std::size_t xi_size) {
+                const detail::FileDescriptor file(xi_path, O_RDWR | O_CREAT | O_TRUNC);
+                if (::ftruncate(file.get(), static_cast<off_t>(xi_size * sizeof(T))) != 0) {
+                    detail::throw_system_error(xi_path);
+                }
+                map(file, xi_size, PROT_READ | PROT_WRITE);
+            }
+
+            // a mapping is owned by a single object
+            MappedFile(const MappedFile&)             = delete;
+            MappedFile& operator =(const MappedFile&) = delete;
+
+            MappedFile(MappedFile&& xi_other) noexcept : m_data(std::exchange(xi_other.m_data, nullptr)), m_size(std::exchange(xi_other.m_size, 0)) {}
+            MappedFile& operator =(MappedFile&& xi_other) noexcept {
+                std::swap(m_data, xi_other.m_data);
+                std::swap(m_size, xi_other.m_size);
+                return *this;
+            }
+
+            ~MappedFile() {
+                if (m_data != nullptr) {
+                    ::munmap(static_cast<void*>(m_data), m_size * sizeof(T));
+                }
+            }
+
+            //
+            // access
+            //
+
+            size_type size() const noexcept { return m_size; }
+
+            T*       data()       noexcept { return m_data; }
+            const T* data() const noexcept { return m_data; }
+
+            reference       operator [](size_type i)       noexcept { return m_data[i]; }
+            const_reference operator [](size_type i) const noexcept { return m_data[i]; }
+
+            iterator       begin()       noexcept { return m_data; }
+            const_iterator begin() const noexcept { return m_data; }
+            iterator       end()         noexcept { return m_data + m_size; }
+            const_iterator end()   const noexcept { return m_data + m_size; }
+
+            // advise the kernel that a range of elements is about to be read
+            void advise(size_type xi_first, size_type xi_last) const noexcept {
+                xi_last = std::min(xi_last, m_size);
+                if (xi_first >= xi_last) {
+                    return;
+                }
+
+                const std::size_t page{ detail::page_size() },
+                                  first{ xi_first * sizeof(T) / page * page };
+                ::madvise(reinterpret_cast<char*>(m_data) + first, xi_last * sizeof(T) - first, MADV_WILLNEED);
+            }
+
+        // internal
+        private:
+
+            // map an open file (an empty file is not mapped)
+            void map(const detail::FileDescriptor& xi_file, std::size_t xi_size, int xi_protection) {
+                if (xi_size == 0) {
+                    return;
+                }
+
+                void* data{ ::mmap(nullptr, xi_size * sizeof(T), xi_protection, MAP_SHARED, xi_file.get(), 0) };
+                if (data == MAP_FAILED) {
+                    detail::throw_system_error("mmap");
+                }
+                ::madvise(data, xi_size * sizeof(T), MADV_SEQUENTIAL);
+                m_data = static_cast<T*>(data);
+                m_size = xi_size;
+            }
+
+        // properties
+        private:
+            T*          m_data{ nullptr };
+            std::size_t m_size{};
+    };
+
+    /**
+    * \brief an expression reading a binary file of trivially copyable elements batch by batch (for files which are not mapped),
+    *        i.e. - 'Lazy::for_each_batch(Lazy::FileReader<float>("a.bin") * 2.0f, Lazy::FileWriter<float>("b.bin"))'
+    *
+    * @param {T, in} element type
+    *
+    * \remarks a prepared range is read as a batch, and an element outside the batch reads the batch starting at it,
+    *          so the buffered batch makes the expression stateful (evaluated by a single thread).
+    **/
+    template<typename T> class FileReader : public detail::ExpressionOperators<FileReader<T>> {
+        static_assert(std::is_trivially_copyable_v<T>, "FileReader<T>: T must be trivially copyable.");
+
+        // aliases
+        public:
+            using value_type = T;
+
+        // properties
+        private:
+            detail::FileDescriptor    m_file;
+            std::size_t               m_size;
+            std::size_t               m_batch;
+            mutable std::vector<T>    m_values;
+            mutable std::size_t       m_first{};
+
+        // constructors
+        public:
+            // open a file, to be read in batches of a given amount of bytes
+            explicit FileReader(const char* xi_path, std::size_t xi_batch_bytes = detail::batch_bytes) :
+                m_file(xi_path, O_RDONLY), m_size(m_file.bytes() / sizeof(T)), m_batch(std::max<std::size_t>(1, xi_batch_bytes / sizeof(T))) {}
+
+            FileReader(const FileReader&)             = delete;
+            FileReader& operator =(const FileReader&) = delete;
+            FileReader(FileReader&&)                  = default;
+
+        // getters
+        public:
+
+            // amount of elements
+            std::size_t size() const noexcept { return m_size; }
+
+            // a file never aliases a destination
+            static constexpr bool is_elementwise = true;
+            constexpr detail::Alias alias(const detail::Region&) const noexcept { return detail::Alias::none; }
+
+            // evaluation keeps the read batch
+            static constexpr bool is_stateful = true;
+
+            // prepare evaluation of an index range (read it, or discard the read batch if it is empty)
+            void prepare(std::size_t xi_first, std::size_t xi_last) const {
+                if (xi_first >= xi_last) {
+                    m_values.clear();
+                } else if ((xi_first < m_first) || (std::min(xi_last, m_size) > m_first + m_values.size())) {
+                    read(xi_first, std::max(xi_last, xi_first + m_batch));
+                }
+            }
+
+            // [] overload to get element at a specific index
+            T operator [](std::size_t index) const {
+                if (index - m_first >= m_values.size()) {
+                    read(index, index + m_batch);
+                }
+                return m_values[index - m_first];
+            }
+
+            // can expression be evaluated in packets?
+            static constexpr bool is_vectorizable = detail::Simd::enabled && std::is_arithmetic_v<T>;
+
+            // get packet starting at a specific index
+            detail::Simd::Packet<T> packet(std::size_t index) const {
+                using packet_type = detail::Simd::Packet<T>;
+                if ((index < m_first) || (index + packet_type::size > m_first + m_values.size())) {
+                    read(index, index + std::max(m_batch, packet_type::size));
+                }
+                return packet_type::load(m_values.data() + (index - m_first));
+            }
+
+        // internal
+        private:
+
+            // read elements [first, last) of file (bounded by its end) as the batch
+            void read(std::size_t xi_first, std::size_t xi_last) const {
+                xi_last = std::min(xi_last, m_size);
+                m_values.resize(xi_last - xi_first);
+                m_first = xi_first;
+
+                char* out{ reinterpret_cast<char*>(m_values.data()) };
+                for (std::size_t done{}, bytes{ m_values.size() * sizeof(T) }; done < bytes;) {
+                    const ::ssize_t count{ ::pread(m_file.get(), out + done, bytes - done, static_cast<off_t>(xi_first * sizeof(T) + done)) };
+                    if (count == 0) {
+                        throw std::runtime_error("Lazy::FileReader: unexpected end of file (file was truncated while it is read).");
+                    } else if (count < 0) {
+                        if (errno == EINTR) {
+                            continue;
+                        }
+                        detail::throw_system_error("pread");
+                    }
+                    done += static_cast<std::size_t>(count);
+                }
+            }
+    };
+
+    /**
+    * \brief a sink (see 'Lazy::for_each_batch') appending batches of trivially copyable elements to a binary file
+    *
+    * @param {T, in} element type
+    **/
+    template<typename T> class FileWriter {
+        static_assert(std::is_trivially_copyable_v<T>, "FileWriter<T>: T must be trivially copyable.");
+
+        // properties
+        private:
+            detail::FileDescriptor m_file;
+
+        public:
+            // create (or truncate) a file
+            explicit FileWriter(const char* xi_path) : m_file(xi_path, O_WRONLY | O_CREAT | O_TRUNC) {}
+
+            // append a batch of elements
+            void operator ()(const T* xi_data, std::size_t xi_count) const {
+                const char* in{ reinterpret_cast<const char*>(xi_data) };
+                for (std::size_t done{}, bytes{ xi_count * sizeof(T) }; done < bytes;) {
+                    const ::ssize_t count{ ::write(m_file.get(), in + done, bytes - done) };
+                    if (count < 0) {
+                        if (errno == EINTR) {
+                            continue;
+                        }
+                        detail::throw_system_error("write");
+                    }
+                    done += static_cast<std::size_t>(count);
+                }
+            }
     };
+#endif
 };
@@ -1,14 +1,20 @@
 #include "MakeLazy.h"
 
 #include<vector>
+#include<string>
 #include<array>
 #include<tuple>
-#include<chrono>
 #include<iostream>
-
-using Clock = std::conditional_t<std::chrono::high_resolution_clock::is_steady,
-    std::chrono::high_resolution_clock,
-    std::chrono::steady_clock>;
+#include<cassert>
+#include<cmath>
+#include<cctype>
+#include<algorithm>
+#include<memory_resource>
+#include<deque>
+#include<list>
+#include<cstdio>
+#include<future>
+#include<stdexcept>
 
 struct Element {
     std::int32_t m_int{};
@@ -35,6 +41,61 @@ struct Element {
     }
 };
 
+// a memory resource counting its allocations
+struct CountingResource : public std::pmr::memory_resource {
+    std::size_t m_allocations{};
+
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+        ++m_allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, const std::size_t bytes, const std::size_t alignment) override { std::pmr::new_delete_resource()->deallocate(p, bytes, alignment); }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// a node reading its container 'k' elements away from the evaluated index (clamped to its bounds) (exercises aliasing analysis of non element wise nodes)
+template<typename C> struct Shifted : public Lazy::detail::ExpressionOperators<Shifted<C>> {
+    using value_type = typename C::value_type;
+    static constexpr bool is_vectorizable = false;
+    static constexpr bool is_elementwise = false;
+
+    const C& m_container;
+    const std::ptrdiff_t m_k;
+
+    Shifted(const C& c, const std::ptrdiff_t k) : m_container(c), m_k(k) {}
+    value_type operator[](const std::size_t i) const {
+        const std::ptrdiff_t j{ std::clamp<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(i) + m_k, 0, static_cast<std::ptrdiff_t>(m_container.size()) - 1) };
+        return m_container[static_cast<std::size_t>(j)];
+    }
+    std::size_t size() const { return m_container.size(); }
+    Lazy::detail::Alias alias(const Lazy::detail::Region& r) const {
+        if (r.collection != static_cast<const void*>(&m_container)) return Lazy::detail::Alias::none;
+        return (m_k > 0) ? Lazy::detail::Alias::forward : Lazy::detail::Alias::backward;
+    }
+};
+
+// evaluate an expression over collections of static extent at compile time
+constexpr std::array<int, 5> static_axpy(const int k) {
+    std::array<int, 5> x{ 1, 2, 3, 4, 5 },
+                       y{ 5, 4, 3, 2, 1 };
+    Lazy::Container<decltype(x)> lazy_x(x);
+    Lazy::Container<decltype(y)> lazy_y(y);
+    lazy_y += k * lazy_x - 1;
+    return y;
+}
+
+// evaluate an associative chain over collections of static extent at compile time
+constexpr std::array<unsigned, 5> static_chain() {
+    std::array<unsigned, 5> x{ 1, 2, 3, 4, 5 },
+                            y{ 5, 4, 3, 2, 1 },
+                            d{};
+    Lazy::Container<decltype(x)> lazy_x(x);
+    Lazy::Container<decltype(y)> lazy_y(y);
+    Lazy::Container<decltype(d)> lazy_d(d);
+    lazy_d = lazy_x + lazy_y + lazy_x + 1u;
+    return d;
+}
+
 int main() {
     
     // test a simple case with std::string
@@ -50,24 +111,1146 @@ int main() {
                                      lazy_c(c),
                                      lazy_d(d);
 
-        // test lazy evaluation
-        Clock::time_point m_start;
+        // test lazy evaluation against element wise evaluation (see Benchmark.cpp for timing)
+        std::vector<std::string> e(d);
         lazy_d += lazy_a + lazy_b + lazy_c;
-        const Clock::time_point end{ Clock::now() };
-        auto lazy_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - m_start).count();
-
-        // element wise evaluation
-        Clock::time_point m_start1;
         for (std::size_t i{}; i < 1000000; ++i) {
-            d[i] += a[i] + b[i] + c[i];
+            e[i] += a[i] + b[i] + c[i];
         }
-        const Clock::time_point end1{ Clock::now() };
-        auto scalar_time = std::chrono::duration_cast<std::chrono::milliseconds>(end1 - m_start1).count();
-        auto diff = lazy_time - scalar_time;
-        bool temp = lazy_time < scalar_time;
-        std::cout << "lazy is " << std::string(temp ? "faster" : "slower");
+        assert(d == e);
     }
     
+    // test that evaluation keeps operand order when the temporary is on the right side
+    {
+        std::vector<std::string> a(10, "a"),
+                                 b(10, "b"),
+                                 c(10, "c"),
+                                 d(10, "d");
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_c(c),
+                                     lazy_d(d);
+
+        lazy_d += lazy_a + (lazy_b + lazy_c);
+        assert(d[0] == "dabc");
+
+        lazy_d = lazy_a + lazy_b + lazy_c;
+        assert(d[9] == "abc");
+    }
+
+    // test packet (SIMD) evaluation of arithmetic containers, including the scalar tail
+    {
+        std::vector<float> a(1'003, 1.0f),
+                           b(1'003, 2.0f),
+                           c(1'003, 3.0f),
+                           d(1'003, 0.5f);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_c(c),
+                                     lazy_d(d);
+        static_assert(decltype(lazy_a + lazy_b + lazy_c)::is_vectorizable == Lazy::detail::Simd::enabled, "arithmetic contiguous expression should be vectorized");
+
+        lazy_d += lazy_a + lazy_b + lazy_c;
+        assert(d.front() == 6.5f && d.back() == 6.5f);
+
+        std::array<std::int32_t, 7> x{ 1, 2, 3, 4, 5, 6, 7 };
+        Lazy::Container<decltype(x)> lazy_x(x);
+        lazy_x = lazy_x + lazy_x;
+        assert(x[0] == 2 && x[6] == 14);
+    }
+
+    // test that mixed operator chains keep their operators and C++ precedence
+    {
+        std::vector<float> a(37, 1.0f),
+                           b(37, 2.0f),
+                           c(37, 3.0f),
+                           d(37, 0.5f);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_c(c),
+                                     lazy_d(d);
+
+        lazy_d += lazy_a + lazy_b * lazy_c;
+        assert(d.front() == 7.5f && d.back() == 7.5f);
+
+        lazy_d = lazy_c - lazy_b * lazy_c / lazy_b - lazy_a;
+        assert(d.front() == -1.0f && d.back() == -1.0f);
+
+        std::vector<std::int32_t> x(9, 12),
+                                  y(9, 2);
+        Lazy::Container<decltype(x)> lazy_x(x),
+                                     lazy_y(y);
+        lazy_x = (lazy_x >> lazy_y) | ((lazy_y << lazy_y) ^ lazy_y);
+        assert(x.front() == ((12 >> 2) | ((2 << 2) ^ 2)) && x.back() == x.front());
+
+        std::vector<bool> mask(37);
+        Lazy::Container<decltype(mask)> lazy_mask(mask);
+        lazy_mask = (lazy_a < lazy_b) && (lazy_c >= lazy_d);
+        assert(mask.front() && mask.back());
+    }
+
+    // test broadcast scalars inside expressions
+    {
+        std::vector<float> a(19, 1.0f),
+                           b(19, 2.0f),
+                           d(19, 0.0f);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_d(d);
+
+        lazy_d = lazy_a * 2.0f + lazy_b;
+        assert(d.front() == 4.0f && d.back() == 4.0f);
+
+        lazy_d -= 0.5f * (lazy_a + lazy_b) - 1;
+        assert(d.front() == 3.5f && d.back() == 3.5f);
+
+        lazy_d = 3;
+        assert(d.front() == 3.0f && d.back() == 3.0f);
+
+        std::vector<std::string> s(3, "lazy");
+        Lazy::Container<decltype(s)> lazy_s(s);
+        lazy_s = "<" + lazy_s + std::string(">");
+        assert(s.front() == "<lazy>" && s.back() == "<lazy>");
+    }
+
+    // test unary and map expressions
+    {
+        std::vector<float> a(21, 1.0f),
+                           b(21, -4.0f),
+                           d(21, 0.0f);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_d(d);
+
+        lazy_d = -lazy_a + -(lazy_a * lazy_b);
+        assert(d.front() == 3.0f && d.back() == 3.0f);
+
+        lazy_d = Lazy::map([](float x, float y) { return std::abs(x) + y; }, lazy_b, lazy_a) * 2.0f;
+        assert(d.front() == 10.0f && d.back() == 10.0f);
+
+        std::vector<std::string> s(5, "lazy"),
+                                 t(5, "");
+        Lazy::Container<decltype(s)> lazy_s(s),
+                                     lazy_t(t);
+        lazy_t = Lazy::map([](std::string x) { for (char& c : x) c = static_cast<char>(std::toupper(c)); return x; }, lazy_s + "!");
+        assert(t.front() == "LAZY!" && t.back() == "LAZY!");
+
+        std::vector<std::int32_t> x(5, 6);
+        std::vector<bool> mask(5);
+        Lazy::Container<decltype(x)> lazy_x(x);
+        Lazy::Container<decltype(mask)> lazy_mask(mask);
+        lazy_mask = !(lazy_x == 5);
+        lazy_x = ~lazy_x;
+        assert(mask.front() && x.front() == ~6 && x.back() == ~6);
+    }
+
+    // test fused reductions
+    {
+        std::vector<float> a(1'001, 0.5f),
+                           b(1'001, 1.5f);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b);
+        a[10] = -3.0f;
+        b[20] = 7.0f;
+        a[30] = 2.0f;
+
+        assert(Lazy::sum(lazy_a + lazy_b) == 2.0f * 1'001 - 3.5f + 5.5f + 1.5f);
+        assert(Lazy::sum(Lazy::parallel, lazy_a + lazy_b) == Lazy::sum(lazy_a + lazy_b));
+        assert(Lazy::min(lazy_a * lazy_b) == -4.5f && Lazy::max(lazy_a * lazy_b) == 3.5f);
+        assert(Lazy::max(Lazy::ParallelPolicy{ 16 }, lazy_a * lazy_b) == 3.5f);
+        assert(Lazy::count(lazy_a < lazy_b) == 1'000 && Lazy::count(Lazy::parallel, lazy_a >= lazy_b) == 1);
+        assert(Lazy::any(lazy_a > lazy_b + 1.0f) == false && Lazy::all(lazy_a < lazy_b + 4.0f) == true);
+        assert(Lazy::reduce(lazy_a, 0.0, [](double acc, float x) { return acc + x; }) == 0.5 * 1'001 - 3.5 + 1.5);
+
+        std::vector<std::string> s{ "ex", "pre", "ssion" };
+        Lazy::Container<decltype(s)> lazy_s(s);
+        assert(Lazy::sum(lazy_s + "_") == "ex_pre_ssion_");
+        assert(Lazy::min(lazy_s) == "ex" && Lazy::max(lazy_s) == "ssion");
+
+        // an empty expression has no smallest element, and an expression of broadcast scalars only can not be reduced
+        std::vector<float> none;
+        Lazy::Container<decltype(none)> lazy_none(none);
+        std::size_t failures{};
+        try { Lazy::min(lazy_none + 1.0f); } catch (const std::invalid_argument&) { ++failures; }
+        try { Lazy::max(Lazy::parallel, lazy_none); } catch (const std::invalid_argument&) { ++failures; }
+        assert(failures == 2 && Lazy::sum(lazy_none) == 0.0f);
+        static_assert(!Lazy::detail::Concepts::is_bounded_v<Lazy::detail::Scalar<float>> && Lazy::detail::Concepts::is_bounded_v<decltype(lazy_none * 2.0f)>, "");
+    }
+
+    // test conditional expressions and masked assignment
+    {
+        std::vector<float> a{ 1, 5, 2, 8, 3, 9, 4, 7, 6, 0, 2 },
+                           b(11, 4.0f),
+                           d(11, 0.0f);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_d(d);
+
+        lazy_d = Lazy::where(lazy_a > lazy_b, lazy_a, -lazy_b);
+        assert(d[0] == -4.0f && d[1] == 5.0f && d[6] == -4.0f && d[10] == -4.0f);
+
+        lazy_d.masked(lazy_a <= lazy_b) += 10.0f;
+        assert(d[0] == 6.0f && d[1] == 5.0f && d[10] == 6.0f);
+
+        lazy_d.masked(lazy_a == 9.0f) = lazy_a * lazy_b;
+        assert(d[5] == 36.0f && d[4] == 6.0f);
+
+        // a named mask holds its condition
+        auto above = lazy_d.masked(lazy_a > 8.0f);
+        above = 5.0f;
+        assert(d[5] == 5.0f && d[4] == 6.0f);
+
+        // the untaken operand of heap owning elements is not evaluated
+        std::size_t evaluated{};
+        std::vector<std::string> s{ "a", "bb", "ccc" },
+                                 t(3);
+        Lazy::Container<decltype(s)> lazy_s(s),
+                                     lazy_t(t);
+        const auto expensive = [&evaluated](const std::string& x) { ++evaluated; return x + x; };
+        lazy_t = Lazy::where(lazy_s == "bb", Lazy::map(expensive, lazy_s), lazy_s);
+        assert(t[0] == "a" && t[1] == "bbbb" && t[2] == "ccc" && evaluated == 1);
+
+        lazy_t.masked(lazy_s != "a") += Lazy::map(expensive, lazy_s);
+        assert(t[0] == "a" && t[1] == "bbbbbbbb" && t[2] == "ccccccccc" && evaluated == 3);
+
+        // integral divisions guarded by a condition (or mask) are only evaluated where it holds
+        std::vector<std::int32_t> x(1'001, 12), y(1'001, 0), z(1'001, 5);
+        for (std::size_t i{}; i < 1'001; i += 3) y[i] = 4;
+        Lazy::Container<decltype(x)> lazy_x(x),
+                                     lazy_y(y),
+                                     lazy_z(z);
+        lazy_z = Lazy::where(lazy_y != 0, lazy_x / lazy_y, lazy_x);
+        assert(z[0] == 3 && z[1] == 12 && z[999] == 3 && z[1'000] == 12);
+        lazy_x.masked(lazy_y != 0) /= lazy_y;
+        assert(x[0] == 3 && x[1] == 12 && x[1'000] == 12);
+    }
+
+    // test that string concatenations allocate each output element once
+    {
+        CountingResource resource;
+        const std::pmr::string long_a("a string which does not fit small string optimization, "),
+                               long_b("neither does this one, ");
+        std::pmr::vector<std::pmr::string> a(100, long_a),
+                                           b(100, long_b),
+                                           d(100, std::pmr::string(&resource), &resource);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_d(d);
+
+        resource.m_allocations = 0;
+        lazy_d = lazy_a + lazy_b + "and " + lazy_a;
+        assert(d.front() == long_a + long_b + "and " + long_a && d.back() == d.front());
+        assert(resource.m_allocations == d.size());
+
+        // capacity of destination elements is reused
+        lazy_d = lazy_b + lazy_a + lazy_b;
+        assert(d[50] == long_b + long_a + long_b && resource.m_allocations == d.size());
+
+        lazy_d += lazy_a + lazy_b;
+        assert(d[99] == long_b + long_a + long_b + long_a + long_b && resource.m_allocations == 2 * d.size());
+
+        // a destination which is part of its own concatenation is still evaluated correctly
+        lazy_d = lazy_a + lazy_d;
+        assert(d[0] == long_a + long_b + long_a + long_b + long_a + long_b);
+    }
+
+    // test cached and materialized sub expressions
+    {
+        std::size_t evaluated{};
+        std::vector<std::string> a{ "a", "bb", "ccc" },
+                                 d(3);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_d(d);
+        const auto counted = [&evaluated](const std::string& x) { ++evaluated; return x + "!"; };
+
+        auto t = Lazy::cache(Lazy::map(counted, lazy_a));
+        lazy_d = t + "_" + t;
+        assert(d[0] == "a!_a!" && d[2] == "ccc!_ccc!" && evaluated == 3);
+
+        // stateful expressions are evaluated by a single thread
+        static_assert(decltype(t + t)::is_stateful, "");
+        Lazy::par(lazy_d, 1) = t + t;
+        assert(d[1] == "bb!bb!" && evaluated == 6);
+
+        std::vector<float> x{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17 },
+                           y(17);
+        Lazy::Container<decltype(x)> lazy_x(x),
+                                     lazy_y(y);
+        auto u = Lazy::cache(lazy_x * lazy_x);
+        static_assert(decltype(u + lazy_x)::is_vectorizable == Lazy::detail::Simd::enabled, "");
+        lazy_y = u + u * lazy_x;
+        assert(y[0] == 2.0f && y[16] == 289.0f + 289.0f * 17.0f);
+
+        // a materialized expression is evaluated once, and is no longer affected by its operands
+        auto m = Lazy::eval(lazy_x + 1.0f);
+        lazy_x = 0.0f;
+        lazy_y = m * 2.0f;
+        assert(y[0] == 4.0f && y[16] == 36.0f && Lazy::sum(m) == 170.0f);
+    }
+
+    // test tiled evaluation
+    {
+        std::size_t evaluated{};
+        std::vector<std::string> a(1'000), d(1'000, "_");
+        for (std::size_t i{}; i < a.size(); ++i) {
+            a[i] = std::to_string(i);
+        }
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_d(d);
+        const auto counted = [&evaluated](const std::string& x) { ++evaluated; return x + x; };
+
+        // cached operands are materialized once per tile, however many parents read them
+        auto t = Lazy::cache(Lazy::map(counted, lazy_a));
+        Lazy::tiled(lazy_d, 512) += t + "|" + t;
+        assert(d[0] == "_00|00" && d[999] == "_999999|999999" && evaluated == 1'000);
+
+        // remembered elements are discarded between evaluations
+        a[999] = "x";
+        Lazy::tiled(lazy_d) = t;
+        assert(d[999] == "xx" && evaluated == 2'000);
+
+        std::vector<float> x(10'000, 2.0f), y(10'000, 3.0f), z(10'000);
+        Lazy::Container<decltype(x)> lazy_x(x),
+                                     lazy_y(y),
+                                     lazy_z(z);
+        Lazy::tiled(lazy_z, 1'000) = lazy_x * lazy_y + 1.0f;
+        Lazy::tiled(lazy_z) -= lazy_x;
+        assert(Lazy::count(lazy_z == 5.0f) == z.size());
+    }
+
+    // test assignment of several destinations in a single traversal
+    {
+        std::vector<float> a(5'000), b(5'000), d(5'000), e(4'000);
+        for (std::size_t i{}; i < a.size(); ++i) {
+            a[i] = static_cast<float>(i);
+            b[i] = 1.0f;
+        }
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_d(d),
+                                     lazy_e(e);
+
+        Lazy::assign_all(std::tie(lazy_d, lazy_e), lazy_a + lazy_b, Lazy::slice(lazy_a, 0, 4'000) - Lazy::slice(lazy_b, 0, 4'000));
+        assert(d[0] == 1.0f && d[4'999] == 5'000.0f && e[0] == -1.0f && e[3'999] == 3'998.0f);
+
+        // later expressions read the already assigned destinations (as sequential assignments would)
+        Lazy::assign_all(std::tie(lazy_d, lazy_e), lazy_a * 2.0f, Lazy::slice(lazy_d, 0, 4'000) + Lazy::slice(lazy_b, 0, 4'000));
+        assert(d[4'999] == 9'998.0f && e[3'999] == 7'999.0f);
+
+        std::size_t evaluated{};
+        std::vector<std::string> s{ "x", "y" }, t(2), u(2);
+        Lazy::Container<decltype(s)> lazy_s(s),
+                                     lazy_t(t),
+                                     lazy_u(u);
+        const auto counted = [&evaluated](const std::string& x) { ++evaluated; return x + x; };
+        auto c = Lazy::cache(Lazy::map(counted, lazy_s));
+        Lazy::assign_all(std::tie(lazy_t, lazy_u), c, c + "?");
+        assert(t[1] == "yy" && u[0] == "xx?" && evaluated == 2);
+    }
+
+    // test fusion of captured assignments into a single loop
+    {
+        std::vector<std::int32_t> a(1'000), b(1'000, 3), d(1'000, 1), e(1'000, 100);
+        for (std::size_t i{}; i < a.size(); ++i) {
+            a[i] = static_cast<std::int32_t>(i);
+        }
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_d(d),
+                                     lazy_e(e);
+
+        Lazy::fuse(Lazy::deferred(lazy_d) += lazy_a + lazy_b,
+                   Lazy::deferred(lazy_e) -= lazy_a * lazy_b,
+                   Lazy::deferred(lazy_b)  = 7);
+        assert(d[0] == 4 && d[999] == 1'003 && e[0] == 100 && e[999] == 100 - 2'997 && b[500] == 7);
+
+        // an expression reading a destination ahead of its index falls back to sequential assignments
+        std::vector<std::int32_t> x{ 1, 2, 3, 4 };
+        Lazy::Container<decltype(x)> lazy_x(x);
+        const Shifted<decltype(x)> ahead(x, 1);
+        auto first_d = Lazy::slice(lazy_d, 0, 4);
+        Lazy::fuse(Lazy::deferred(lazy_x) *= 10, Lazy::deferred(first_d) = ahead + 0);
+        assert(x[0] == 10 && d[0] == 20 && d[2] == 40 && d[3] == 40);
+
+        // a window destination writing elements read by an earlier expression (in the following block) falls back to sequential assignments
+        std::vector<float> w(10'000), v(10'000);
+        for (std::size_t i{}; i < w.size(); ++i) {
+            w[i] = static_cast<float>(i);
+        }
+        Lazy::Container<decltype(w)> lazy_w(w),
+                                     lazy_v(v);
+        auto ahead_w = Lazy::shift(lazy_w, 1);
+        Lazy::fuse(Lazy::deferred(lazy_v) = lazy_w, Lazy::deferred(ahead_w) = -1.0f);
+        [[maybe_unused]] bool fused{ true };
+        for (std::size_t i{}; i < v.size(); ++i) {
+            fused = fused && (v[i] == static_cast<float>(i));
+        }
+        assert(fused && w[1] == -1.0f);
+    }
+
+    // test views over sub ranges, strides and shifts
+    {
+        using Lazy::detail::Alias;
+        std::vector<float> a{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 },
+                           d(20, 0.0f);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_d(d);
+
+        // contiguous views keep packet evaluation, strided views do not
+        static_assert(std::decay_t<decltype(Lazy::slice(lazy_a, 0, 1))>::is_vectorizable == Lazy::detail::Simd::enabled, "");
+        static_assert(!std::decay_t<decltype(Lazy::stride(lazy_a, 2))>::is_vectorizable, "");
+
+        Lazy::slice(lazy_d, 0, 10) = Lazy::slice(lazy_a, 10, 20) + Lazy::slice(lazy_a, 0, 10);
+        assert(d[0] == 10.0f && d[9] == 28.0f && d[10] == 0.0f);
+
+        // every other element (as interleaved pairs)
+        Lazy::stride(lazy_d, 2) = 2.0f * Lazy::stride(Lazy::shift(lazy_a, 1), 2);
+        assert(d[0] == 2.0f && d[1] == 12.0f && d[18] == 38.0f && d[19] == 0.0f);
+        [[maybe_unused]] auto odd = Lazy::stride(Lazy::shift(lazy_d, 1), 2);
+        assert(odd.size() == 10 && odd[0] == 12.0f && Lazy::sum(odd) == 12.0f + 16.0f + 20.0f + 24.0f + 28.0f);
+
+        // views of views compose
+        [[maybe_unused]] auto middle = Lazy::slice(lazy_a, 5, 15);
+        assert(Lazy::slice(middle, 2, 4)[0] == 7.0f && Lazy::stride(middle, 5)[1] == 10.0f && Lazy::shift(middle, -2).size() == 8);
+
+        // views over the destination are classified and evaluated safely in place
+        auto head = Lazy::shift(lazy_a, -1), tail = Lazy::shift(lazy_a, 1);
+        assert(tail.alias(head.region()) == Alias::forward && head.alias(tail.region()) == Alias::backward);
+        assert(Lazy::stride(lazy_a, 2).alias(Lazy::stride(Lazy::shift(lazy_a, 1), 2).region()) == Alias::none);
+        assert(Lazy::stride(lazy_a, 2).alias(head.region()) == Alias::unknown);
+
+        head = tail - head;
+        assert(a[0] == 1.0f && a[18] == 1.0f && a[19] == 19.0f);
+
+        std::vector<float> b{ 1, 2, 3, 4, 5, 6 };
+        Lazy::Container<decltype(b)> lazy_b(b);
+        auto b_tail = Lazy::shift(lazy_b, 1);
+        b_tail += Lazy::shift(lazy_b, -1);
+        assert(b[0] == 1.0f && b[1] == 3.0f && b[5] == 11.0f);
+
+        // a strided view reading the destination contiguously goes through a scratch buffer
+        Lazy::slice(lazy_b, 0, 3) = Lazy::stride(lazy_b, 2);
+        assert(b[0] == 1.0f && b[1] == 5.0f && b[2] == 9.0f && b[3] == 7.0f);
+
+        // views of heavy elements are assigned in place
+        std::vector<std::string> s{ "a", "b", "c", "d" };
+        Lazy::Container<decltype(s)> lazy_s(s);
+        Lazy::slice(lazy_s, 2, 4) += Lazy::slice(lazy_s, 0, 2) + "!";
+        assert(s[2] == "ca!" && s[3] == "db!");
+
+        // an expression over temporary views holds the views, so it outlives the statement building it
+        auto over_views = Lazy::slice(lazy_a, 4, 8) + -Lazy::shift(lazy_b, 2);
+        Lazy::slice(lazy_d, 0, 4) = over_views;
+        assert(d[0] == a[4] - b[2] && d[3] == a[7] - b[5]);
+    }
+
+    // test evaluation when the destination appears inside the expression
+    {
+        using Lazy::detail::Alias;
+        std::vector<float> a{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 },
+                           b(10, 1.0f);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b);
+
+        // element wise expressions are statically known to be safe in place
+        static_assert(decltype(lazy_b + lazy_a * 2.0f)::is_elementwise, "");
+        assert((lazy_b + lazy_a).alias(lazy_a.region()) == Alias::elementwise);
+        assert((lazy_b + 1.0f).alias(lazy_a.region()) == Alias::none);
+        lazy_a = lazy_b + lazy_a;
+        assert(a[0] == 2.0f && a[9] == 11.0f);
+
+        // reading ahead is evaluated forward in place, reading behind is evaluated backward in place
+        std::vector<float> f{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        Lazy::Container<decltype(f)> lazy_f(f);
+        const std::vector<float> expected{ 2, 3, 4, 5, 6, 7, 8, 9, 10, 10 };
+        const Shifted<decltype(f)> ahead(f, 1);
+        assert((ahead + lazy_f).alias(lazy_f.region()) == Alias::forward);
+        lazy_f = ahead;
+        assert(std::equal(f.begin(), f.end(), expected.begin()));
+
+        std::vector<float> g{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        Lazy::Container<decltype(g)> lazy_g(g);
+        const Shifted<decltype(g)> behind(g, -1);
+        lazy_g.masked(lazy_g > 1.0f) = behind + 0.0f;
+        assert(g[0] == 1.0f && g[1] == 1.0f && g[9] == 9.0f);
+
+        // reading both ahead and behind needs a scratch buffer
+        std::vector<float> h{ 1, 2, 3, 4, 5, 6 };
+        Lazy::Container<decltype(h)> lazy_h(h);
+        const Shifted<decltype(h)> h_ahead(h, 1), h_behind(h, -1);
+        assert((h_ahead + h_behind).alias(lazy_h.region()) == Alias::unknown);
+        Lazy::par(lazy_h, 1) = h_ahead + h_behind;
+        assert(h[0] == 3.0f && h[1] == 4.0f && h[3] == 8.0f && h[4] == 10.0f);
+    }
+
+    // test parallel evaluation (small grain, so chunks are used whenever more than one hardware thread exists)
+    {
+        std::vector<std::string> a(10'000, "expression "),
+                                 b(10'000, "template "),
+                                 d(10'000, "_");
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_d(d);
+
+        Lazy::par(lazy_d, 64) += lazy_a + lazy_b;
+        assert(d.front() == "_expression template " && d.back() == "_expression template ");
+
+        std::vector<float> x(10'001, 1.0f);
+        Lazy::Container<decltype(x)> lazy_x(x);
+        Lazy::par(lazy_x, 64) = lazy_x + lazy_x;
+        Lazy::par(lazy_x, 64) *= 0.25f;
+        assert(x.front() == 0.5f && x.back() == 0.5f);
+
+        // chunks of a view are aligned to the cache lines of its elements
+        auto x_tail = Lazy::slice(lazy_x, 3, 10'001);
+        Lazy::par(x_tail, 64) = x_tail + 1.0f;
+        assert(x[2] == 0.5f && x[3] == 1.5f && x[5'000] == 1.5f && x[10'000] == 1.5f);
+
+        // a parallel evaluation nested in a chunk runs in the thread evaluating the chunk
+        std::vector<float> n(256, 1.0f);
+        Lazy::Container<decltype(n)> lazy_n(n);
+        Lazy::par(lazy_n, 1) = Lazy::map([&lazy_x](float xi_x) { return xi_x + Lazy::sum(Lazy::ParallelPolicy{ 64 }, lazy_x); }, lazy_n);
+        assert(n[0] == 1.0f + 3.0f * 0.5f + 9'998.0f * 1.5f && n[255] == n[0]);
+    }
+
+    // test segmented (deque) and forward only (list) collections, which are evaluated through their iterators
+    {
+        std::deque<float> a, b, d(5'000, 1.0f);
+        for (std::size_t i{}; i < 5'000; ++i) {
+            a.push_front(static_cast<float>(i));
+            b.push_back(2.0f);
+        }
+        std::vector<float> v(5'000, 3.0f);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_d(d);
+        Lazy::Container<decltype(v)> lazy_v(v);
+        static_assert(decltype(lazy_a + lazy_v)::is_segmented && !decltype(lazy_v * 2.0f)::is_segmented);
+
+        lazy_d += lazy_a * lazy_b - lazy_v;
+        assert(d.front() == 9'996.0f && d.back() == -2.0f);
+
+        lazy_v = Lazy::where(lazy_a > 2'500.0f, lazy_b, -lazy_b);
+        assert(v.front() == 2.0f && v.back() == -2.0f);
+        assert(Lazy::sum(lazy_b) == 10'000.0f && Lazy::count(lazy_a < 10.0f) == 10 && Lazy::all(lazy_b == 2.0f) && !Lazy::any(lazy_a < 0.0f));
+
+        std::list<int> l{ 1, 2, 3, 4 }, m(4, 0);
+        std::vector<int> w{ 10, 20, 30, 40 };
+        Lazy::Container<decltype(l)> lazy_l(l),
+                                     lazy_m(m);
+        Lazy::Container<decltype(w)> lazy_w(w);
+        lazy_m = lazy_l * 2 + lazy_w;
+        lazy_w = Lazy::map([](int x, int y) { return x - y; }, lazy_m, lazy_l);
+        assert(m.front() == 12 && m.back() == 48 && w[0] == 11 && w[3] == 44);
+        assert(Lazy::reduce(lazy_l, 0, std::plus<int>{}) == 10);
+    }
+
+#if defined(MAKELAZY_MMAP)
+    // test streaming evaluation over memory mapped and file backed data
+    {
+        std::vector<float> a(100'003), b(100'003, 0.5f);
+        for (std::size_t i{}; i < a.size(); ++i) a[i] = static_cast<float>(i % 1'000);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b);
+
+        // write files batch by batch
+        Lazy::for_each_batch(lazy_a, Lazy::FileWriter<float>("lazy_test_a.bin"), 4'096);
+        Lazy::for_each_batch(lazy_b * 2.0f, Lazy::FileWriter<float>("lazy_test_b.bin"));
+        {
+            // read a mapped file and a batched file into a mapped destination
+            Lazy::MappedFile<float> ma("lazy_test_a.bin"), md("lazy_test_d.bin", a.size());
+            Lazy::FileReader<float> rb("lazy_test_b.bin", 1'000);
+            assert(ma.size() == a.size() && rb.size() == a.size());
+            Lazy::Container<decltype(ma)> lazy_ma(ma),
+                                          lazy_md(md);
+            Lazy::tiled(lazy_md, 1 << 14) = lazy_ma * rb + 1.0f;
+            assert(md[0] == 1.0f && md[999] == 1'000.0f && md[100'002] == 3.0f);
+            assert(Lazy::sum(rb) == static_cast<float>(a.size()) && Lazy::count(lazy_ma == 0.0f) == 101);
+
+            // an expression over a temporary reader holds the reader
+            auto read_twice = Lazy::FileReader<float>("lazy_test_b.bin") * 2.0f;
+            assert(Lazy::sum(read_twice) == 2.0f * static_cast<float>(a.size()));
+        }
+
+        // stream a mapped file through an expression, bounded by a batch
+        std::vector<float> d;
+        Lazy::MappedFile<float> md("lazy_test_d.bin");
+        Lazy::Container<decltype(md)> lazy_md(md);
+        std::size_t batches{};
+        Lazy::for_each_batch(lazy_md - lazy_a, [&](const float* xi_data, std::size_t xi_count) {
+            assert(xi_count <= 1'024);
+            d.insert(d.end(), xi_data, xi_data + xi_count);
+            ++batches;
+        }, 4'096);
+        assert(batches == 98 && d.size() == a.size() && std::all_of(d.begin(), d.end(), [](float x) { return x == 1.0f; }));
+
+        // a file truncated while it is read is reported as such
+        [[maybe_unused]] bool truncated{ false };
+        {
+            Lazy::FileReader<float> ra("lazy_test_a.bin", 4'096);
+            Lazy::FileWriter<float> truncate("lazy_test_a.bin");
+            try { Lazy::sum(ra); } catch (const std::system_error&) {} catch (const std::runtime_error&) { truncated = true; }
+        }
+        assert(truncated);
+
+        std::remove("lazy_test_a.bin");
+        std::remove("lazy_test_b.bin");
+        std::remove("lazy_test_d.bin");
+    }
+#endif
+
+    // test collections of static extent (fully unrolled, or tiled by packets without a runtime tail)
+    {
+        std::array<float, 4>  a4{ 1, 2, 3, 4 },  d4{};
+        std::array<float, 19> a19{},             d19{};
+        std::array<double, 100> a100{},          d100{};
+        std::vector<float> v19(19, 2.0f);
+        for (std::size_t i{}; i < 19; ++i)  a19[i]  = static_cast<float>(i);
+        for (std::size_t i{}; i < 100; ++i) a100[i] = static_cast<double>(i);
+        Lazy::Container<decltype(a4)>   lazy_a4(a4),     lazy_d4(d4);
+        Lazy::Container<decltype(a19)>  lazy_a19(a19),   lazy_d19(d19);
+        Lazy::Container<decltype(a100)> lazy_a100(a100), lazy_d100(d100);
+        Lazy::Container<decltype(v19)>  lazy_v19(v19);
+
+        // extents propagate through expressions, over dynamic operands and broadcast scalars
+        static_assert(decltype(lazy_a4)::extent == 4 && decltype(lazy_v19)::extent == Lazy::detail::dynamic_extent);
+        static_assert(decltype(lazy_a19 * lazy_v19 + 1.0f)::extent == 19 && decltype(2.0f * lazy_v19)::extent == Lazy::detail::dynamic_extent);
+
+        lazy_d4 = lazy_a4 * 2.0f + 1.0f;
+        assert(d4[0] == 3.0f && d4[3] == 9.0f);
+
+        lazy_d19 = lazy_a19 * lazy_v19;
+        lazy_d19 -= lazy_a19;
+        for (std::size_t i{}; i < 19; ++i) assert(d19[i] == a19[i]);
+
+        lazy_d100 = Lazy::where(lazy_a100 < 50.0, -lazy_a100, lazy_a100);
+        assert(d100[0] == 0.0 && d100[49] == -49.0 && d100[50] == 50.0 && d100[99] == 99.0);
+
+        // compile time evaluation
+        constexpr std::array<int, 5> y{ static_axpy(3) };
+        static_assert(y[0] == 7 && y[2] == 11 && y[4] == 15);
+    }
+
+    // test asynchronous assignments, scheduled by their dependencies
+    {
+        std::vector<float> a(10'000, 1.0f), b(10'000, 2.0f), c(10'000), d(10'000), e(10'000);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_c(c),
+                                     lazy_d(d),
+                                     lazy_e(e);
+
+        // a manual executor, so the order in which tasks become ready is observed
+        std::vector<std::function<void()>> ready;
+        Lazy::TaskGraph graph([&ready](std::function<void()> xi_task) { ready.push_back(std::move(xi_task)); });
+        std::future<void> fc{ graph.assign(lazy_c, (lazy_a + lazy_b) * 1.0f) },
+                          fd{ graph.assign(lazy_d, lazy_a * lazy_b + 1.0f) },
+                          fe{ graph.assign(lazy_e, lazy_c + lazy_d) },
+                          fa{ graph.assign(lazy_a, 0.0f) };
+        assert(ready.size() == 2);
+
+        // evaluate the most recently readied task first
+        while (!ready.empty()) {
+            std::function<void()> task{ std::move(ready.back()) };
+            ready.pop_back();
+            task();
+        }
+        fc.get();
+        fd.get();
+        fe.get();
+        fa.get();
+        assert(c[0] == 3.0f && d[9'999] == 3.0f && e[0] == 6.0f && e[9'999] == 6.0f && a[0] == 0.0f);
+
+        // a failure fails the assignments depending on it (without evaluating them)
+        std::future<void> ff{ graph.assign(lazy_c, Lazy::map([](float x) -> float { if (x == 0.0f) throw std::runtime_error("zero"); return x; }, lazy_a)) },
+                          fg{ graph.assign(lazy_e, lazy_c + 1.0f) };
+        assert(ready.size() == 1);
+        while (!ready.empty()) {
+            std::function<void()> task{ std::move(ready.back()) };
+            ready.pop_back();
+            task();
+        }
+        std::size_t failures{};
+        try { ff.get(); } catch (const std::runtime_error&) { ++failures; }
+        try { fg.get(); } catch (const std::runtime_error&) { ++failures; }
+        assert(failures == 2 && e[0] == 6.0f);
+
+        // the process wide graph
+        std::future<void> f1{ Lazy::async_assign(lazy_d, lazy_b * 2.0f) },
+                          f2{ Lazy::async_assign(lazy_e, lazy_d - lazy_b) };
+        f2.get();
+        f1.get();
+        assert(e[0] == 2.0f && e[9'999] == 2.0f);
+    }
+
+    // test associative chains (flattened into balanced trees)
+    {
+        std::vector<float> a(1'003), b(1'003, 0.5f), d(1'003);
+        std::vector<int>   ia(1'003, 3), id(1'003);
+        for (std::size_t i{}; i < 1'003; ++i) a[i] = static_cast<float>(i);
+        Lazy::Container<decltype(a)>  lazy_a(a),
+                                      lazy_b(b),
+                                      lazy_d(d);
+        Lazy::Container<decltype(ia)> lazy_ia(ia),
+                                      lazy_id(id);
+
+        // a chain is vectorized as a whole
+        static_assert(Lazy::detail::Concepts::has_chain_v<decltype(lazy_a + lazy_b + lazy_a)> && !Lazy::detail::Concepts::has_chain_v<decltype(lazy_a + lazy_b)>);
+        static_assert(decltype(Lazy::detail::flatten(lazy_a + lazy_b + lazy_a))::is_vectorizable == Lazy::detail::Simd::enabled);
+
+        // a 32 deep chain
+        lazy_d = lazy_a + lazy_a + lazy_a + lazy_a + lazy_a + lazy_a + lazy_a + lazy_a +
+                       lazy_a + lazy_a + lazy_a + lazy_a + lazy_a + lazy_a + lazy_a + lazy_a +
+                       lazy_a + lazy_a + lazy_a + lazy_a + lazy_a + lazy_a + lazy_a + lazy_a +
+                       lazy_a + lazy_a + lazy_a + lazy_a + lazy_a + lazy_a + lazy_a + lazy_a;
+        for (std::size_t i{}; i < 1'003; ++i) assert(d[i] == 32.0f * a[i]);
+
+        lazy_id = lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia +
+                  lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia +
+                  lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia +
+                  lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia + lazy_ia;
+        assert(std::all_of(id.begin(), id.end(), [](int x) { return x == 96; }));
+
+        // signed integral '+' and '*' chains are evaluated as written (a balanced '(c + d)' would overflow), unsigned and bitwise ones are balanced
+        std::vector<int> na(4, -5), nb(4, 0), nc(4, std::numeric_limits<int>::max()), nd(4, 1), ne(4);
+        Lazy::Container<decltype(na)> lazy_na(na),
+                                      lazy_nb(nb),
+                                      lazy_nc(nc),
+                                      lazy_nd(nd),
+                                      lazy_ne(ne);
+        lazy_ne = lazy_na + lazy_nb + lazy_nc + lazy_nd;
+        assert(ne[3] == std::numeric_limits<int>::max() - 4 && Lazy::max(lazy_na + lazy_nb + lazy_nc + lazy_nd) == ne[0]);
+        static_assert(!Lazy::detail::Concepts::has_chain_v<decltype(lazy_na + lazy_nb + lazy_nc)> && !Lazy::detail::Concepts::has_chain_v<decltype(lazy_na * lazy_nb * lazy_nc)> &&
+                      Lazy::detail::Concepts::has_chain_v<decltype(lazy_na ^ lazy_nb ^ lazy_nc)>);
+
+        // chains nested in other operations, with scalars and compound assignment
+        lazy_d = (lazy_a + lazy_b + 1.0f) * (lazy_b * lazy_b * 4.0f) - Lazy::where(lazy_a < 10.0f, lazy_b * lazy_b * lazy_b, lazy_b);
+        assert(d[0] == 1.5f - 0.125f && d[100] == 101.5f - 0.5f);
+        lazy_d += lazy_b + lazy_b + lazy_b;
+        assert(d[0] == 1.5f - 0.125f + 1.5f && d[100] == 101.5f - 0.5f + 1.5f);
+
+        // string chains keep their single reservation
+        std::vector<std::string> s(3, "ab"), sd(3);
+        Lazy::Container<decltype(s)> lazy_s(s),
+                                     lazy_sd(sd);
+        lazy_sd = lazy_s + lazy_s + lazy_s + lazy_s;
+        assert(sd[2] == "abababab");
+
+        // every evaluation associates a chain alike, i.e. - '(x + y) + (z + y)' rather than '((x + y) + z) + y'
+        std::vector<float> x(1'000, 1e8f), y(1'000, 1.0f), z(1'000, -1e8f), e(1'000);
+        Lazy::Container<decltype(x)> lazy_x(x),
+                                     lazy_y(y),
+                                     lazy_z(z),
+                                     lazy_e(e);
+        const auto rounded = lazy_x + lazy_y + lazy_z + lazy_y;
+        [[maybe_unused]] const auto zeroed = [&e] {
+            const bool out{ std::all_of(e.begin(), e.end(), [](float v) { return v == 0.0f; }) };
+            std::fill(e.begin(), e.end(), 5.0f);
+            return out;
+        };
+        lazy_e = rounded;
+        assert(zeroed());
+        Lazy::par(lazy_e, 64) = rounded;
+        assert(zeroed());
+        Lazy::tiled(lazy_e, 64) = rounded;
+        assert(zeroed());
+        lazy_e.masked(lazy_x > 0.0f) = rounded;
+        assert(zeroed());
+        Lazy::assign_all(std::tie(lazy_e, lazy_d), rounded, lazy_a);
+        assert(zeroed());
+        assert(Lazy::sum(rounded) == 0.0f && Lazy::max(Lazy::parallel, rounded) == 0.0f && !Lazy::any(rounded));
+
+        // ...also at compile time
+        constexpr std::array<unsigned, 5> chained{ static_chain() };
+        static_assert(chained[0] == 8 && chained[4] == 12);
+    }
+
+    // test stored expressions (nodes are held by value, so an expression can be built once and evaluated repeatedly)
+    {
+        std::vector<float> a(1'003, 1.0f), b(1'003, 2.0f), c(1'003, 3.0f), d(1'003);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_c(c),
+                                     lazy_d(d);
+
+        auto e = (lazy_a + lazy_b) * lazy_c - Lazy::where(lazy_a > 1.0f, -lazy_a, Lazy::map([](float x) { return x * 0.5f; }, lazy_b + 1.0f));
+        static_assert(std::is_copy_constructible_v<decltype(e)> && std::is_same_v<decltype(e.re().te()), const Lazy::detail::UnaryExpression<const decltype(lazy_a)&, Lazy::detail::UnaryOperations::NEG<float>>&>);
+        static_assert(std::is_reference_v<decltype(std::declval<decltype(e)>().le().le().le())>);
+
+        for (float x : { 1.0f, 2.0f, 3.0f }) {
+            std::fill(a.begin(), a.end(), x);
+            lazy_d = e;
+            assert(d[0] == (x + 2.0f) * 3.0f - (x > 1.0f ? -x : 1.5f) && d[1'002] == d[0]);
+        }
+
+        // copies (and expressions holding them) evaluate the same leaves
+        const auto copy{ e };
+        auto twice = copy + e;
+        lazy_d = twice;
+        assert(d[0] == 2.0f * (5.0f * 3.0f + 3.0f));
+
+        // stored expressions evaluated in parallel and asynchronously
+        auto chain = lazy_a + lazy_b + lazy_c;
+        Lazy::async_assign(lazy_d, chain).get();
+        assert(d[0] == 8.0f && d[1'002] == 8.0f);
+        Lazy::par(lazy_d, 64) = chain * 2.0f;
+        assert(d[0] == 16.0f && d[1'002] == 16.0f);
+    }
+
+    // test runtime built expression graphs
+    {
+        std::vector<float> a(1'003), b(1'003, 2.0f), c(1'003, 4.0f), d(1'003);
+        std::deque<float>  q(1'003, 1.0f);
+        for (std::size_t i{}; i < 1'003; ++i) a[i] = static_cast<float>(i);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_c(c),
+                                     lazy_d(d);
+        Lazy::Container<decltype(q)> lazy_q(q);
+
+        // columns are chosen at runtime
+        const std::vector<const Lazy::Container<decltype(a)>*> columns{ &lazy_a, &lazy_b, &lazy_c };
+        Lazy::Dynamic<float> graph{ 0.0f };
+        for (const auto* column : columns) {
+            graph = graph + Lazy::column(*column) * 2.0f;
+        }
+        [[maybe_unused]] const std::size_t shapes{ Lazy::detail::Runtime::compiled<float>() };
+        lazy_d = Lazy::compile(graph);
+        for (std::size_t i{}; i < 1'003; ++i) assert(d[i] == 2.0f * a[i] + 12.0f);
+
+        // a graph of an already compiled shape is not compiled again, and mixes with static expressions and segmented columns
+        Lazy::Dynamic<float> other{ 1.0f };
+        for (const auto* column : { &lazy_c, &lazy_a, &lazy_b }) {
+            other = other + Lazy::column(*column) * 2.0f;
+        }
+        lazy_d = Lazy::compile(other) - lazy_c + Lazy::compile((Lazy::column(lazy_q) - 3.0f) / Lazy::column(lazy_b));
+        assert(Lazy::detail::Runtime::compiled<float>() == shapes + 2);
+        for (std::size_t i{}; i < 1'003; ++i) assert(d[i] == 2.0f * a[i] + 9.0f - 1.0f);
+
+        // aliasing with destination
+        lazy_a = Lazy::compile(Lazy::column(lazy_a) + Lazy::column(lazy_a) * Lazy::column(lazy_b));
+        assert(a[0] == 0.0f && a[1'002] == 3.0f * 1'002.0f);
+
+        // columns are read as the graph is evaluated (rather than as it is built)
+        std::vector<float> g(10, 1.0f);
+        Lazy::Container<decltype(g)> lazy_g(g);
+        const Lazy::Dynamic<float> twice{ Lazy::column(lazy_g) * 2.0f };
+        g.assign(1'003, 3.0f);
+        lazy_d = Lazy::compile(twice);
+        assert(d[0] == 6.0f && d[1'002] == 6.0f);
+
+        // integral bit operations
+        std::vector<int> ia(100, 6), id(100);
+        Lazy::Container<decltype(ia)> lazy_ia(ia),
+                                      lazy_id(id);
+        lazy_id = Lazy::compile((Lazy::column(lazy_ia) & 3) ^ Lazy::column(lazy_ia));
+        assert(std::all_of(id.begin(), id.end(), [](int x) { return x == 4; }));
+
+        // strings are interpreted
+        std::vector<std::string> s(10, "ab"), sd(10);
+        Lazy::Container<decltype(s)> lazy_s(s),
+                                     lazy_sd(sd);
+        lazy_sd = Lazy::compile(Lazy::column(lazy_s) + std::string("-") + Lazy::column(lazy_s));
+        assert(sd[9] == "ab-ab" && !Lazy::compile(Lazy::column(lazy_s)).is_compiled());
+    }
+
+    // test consumed containers (elements are moved from, so their buffers are reused)
+    {
+        std::vector<std::string> a(10'000, "consumed "), b(10'000, "expression"), c(10'000, "!"), d(10'000);
+        std::vector<const char*> buffers(10'000);
+        for (std::size_t i{}; i < 10'000; ++i) {
+            a[i].reserve(64);
+            buffers[i] = a[i].data();
+        }
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_c(c),
+                                     lazy_d(d);
+
+        // a concatenation is built in the element moved out of its leftmost operand
+        lazy_d = Lazy::consume(lazy_a) + lazy_b + lazy_c;
+        for (std::size_t i{}; i < 10'000; ++i) assert(d[i] == "consumed expression!" && d[i].data() == buffers[i]);
+
+        // ...also in place
+        lazy_d = Lazy::consume(lazy_d) + lazy_c;
+        assert(d[0] == "consumed expression!!" && d[0].data() == buffers[0]);
+        Lazy::detail::assign_concatenation(d[1], Lazy::consume(lazy_d) + lazy_c, 1);
+        assert(d[1] == "consumed expression!!!" && d[1].data() == buffers[1]);
+
+        // ...and back
+        lazy_a = Lazy::consume(lazy_d) + lazy_b;
+        assert(a[9'999] == "consumed expression!!expression" && a[9'999].data() == buffers[9'999]);
+
+        // arithmetic, segmented and parallel consumption
+        std::vector<float> x(1'003, 1.0f), z(1'003, 1.0f), y(1'003);
+        std::list<float>   l(1'003, 2.0f);
+        Lazy::Container<decltype(x)> lazy_x(x),
+                                     lazy_z(z),
+                                     lazy_y(y);
+        Lazy::Container<decltype(l)> lazy_l(l);
+        lazy_y = Lazy::consume(lazy_x) * 2.0f + Lazy::consume(lazy_l);
+        Lazy::par(lazy_y, 64) += Lazy::consume(lazy_z);
+        assert(y[0] == 5.0f && y[1'002] == 5.0f);
+    }
+
+    // test sparse and run length encoded leaves (evaluated over their non zeros, or once per run)
+    {
+        std::vector<float> a(1'000, 2.0f), b(1'000, 1.0f), d(1'000, 7.0f);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_d(d);
+        Lazy::Sparse<float> s(1'000);
+        s.set(900, 3.0f);
+        s.set(10, 1.0f);
+        s.set(500, 2.0f);
+        s.set(500, 4.0f);
+        assert(s.indices().size() == 3 && s.indices().front() == 10 && s[500] == 4.0f && s[501] == 0.0f);
+
+        // sparse times dense is evaluated over the non zeros (so a 'NaN' off them is not read)
+        a[11] = std::nan("");
+        lazy_d = s * lazy_a;
+        assert(d[10] == 2.0f && d[11] == 0.0f && d[500] == 8.0f && d[900] == 6.0f && d[999] == 0.0f);
+
+        // ...also as a compound assignment
+        lazy_d += -s * lazy_b;
+        assert(d[10] == 1.0f && d[500] == 4.0f && d[900] == 3.0f && d[0] == 0.0f);
+
+        // dense plus sparse is evaluated as the dense operand and then the non zeros
+        lazy_d = lazy_b - s;
+        assert(d[0] == 1.0f && d[10] == 0.0f && d[500] == -3.0f && d[999] == 1.0f);
+        lazy_d -= lazy_b * 2.0f + s;
+        assert(d[0] == -1.0f && d[10] == -3.0f && d[500] == -9.0f);
+
+        // run length encoded strings are evaluated once per run
+        std::vector<std::string> v{ "a", "a", "a", "b", "b", "a" }, t(6);
+        Lazy::Container<decltype(t)> lazy_t(t);
+        Lazy::Rle<std::string> r(v);
+        assert(r.runs() == 3 && r.size() == 6 && r[4] == "b");
+        std::size_t calls{};
+        lazy_t = Lazy::map([&calls](const std::string& x) { ++calls; return x + x; }, r) + "!";
+        assert(calls == 3 && t[0] == "aa!" && t[3] == "bb!" && t[5] == "aa!");
+
+        // ...as are expressions of run length encoded and sparse leaves
+        Lazy::Rle<float> e;
+        e.push_back(1.0f, 400);
+        e.push_back(2.0f, 600);
+        lazy_d = e * 2.0f + s;
+        assert(d[0] == 2.0f && d[10] == 3.0f && d[399] == 2.0f && d[400] == 4.0f && d[500] == 8.0f && d[999] == 4.0f);
+    }
+
+    // test offloaded assignments (evaluated on the accelerator if offloading is enabled, otherwise in parallel on the host)
+    {
+        std::vector<float> a(10'000), b(10'000, 1.0f), d(10'000, 5.0f);
+        for (std::size_t i{}; i < 10'000; ++i) a[i] = static_cast<float>(i);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_d(d);
+        static_assert(Lazy::Offload<decltype(a)>::is_offloaded<decltype(Lazy::where(lazy_a > lazy_b, lazy_a * 2.0f, -lazy_b))> == Lazy::detail::Offload::enabled);
+
+        Lazy::offload(lazy_d, 1) = lazy_a * 2.0f + lazy_b;
+        assert(d[0] == 1.0f && d[9'999] == 19'999.0f);
+        Lazy::offload(lazy_d, 1) -= Lazy::where(lazy_a > 5'000.0f, lazy_b, -lazy_a) + lazy_d;
+        assert(d[0] == 0.0f && d[10] == 10.0f && d[9'999] == -1.0f);
+
+        // resident containers are transferred once (elements changed on the host are transferred once evicted)
+        Lazy::resident(lazy_a);
+        Lazy::resident(lazy_d);
+        Lazy::offload(lazy_d, 1) = lazy_a;
+        for (int k{}; k < 3; ++k) {
+            Lazy::offload(lazy_d, 1) += lazy_a * lazy_b;
+        }
+        assert(d[1] == 4.0f && d[9'999] == 39'996.0f);
+        Lazy::evict(lazy_a);
+        a[1] = 0.0f;
+        Lazy::offload(lazy_d, 1) -= lazy_a;
+        assert(d[1] == 4.0f && d[2] == 6.0f);
+        Lazy::evict(lazy_d);
+
+        // integral expressions, and (host) fallback of expressions which can not be offloaded
+        std::vector<int> x(1'000, 3);
+        std::vector<std::string> s(1'000, "host");
+        Lazy::Container<decltype(x)> lazy_x(x);
+        Lazy::Container<decltype(s)> lazy_s(s);
+        Lazy::offload(lazy_x, 1) = (lazy_x << 1) ^ 1;
+        Lazy::offload(lazy_s, 1) += lazy_s + "!";
+        static_assert(!Lazy::Offload<decltype(s)>::is_offloaded<decltype(lazy_s + "!")>);
+        assert(x[999] == 7 && s[999] == "hosthost!");
+    }
+
+    // test streaming (non temporal) stores
+    {
+        std::vector<float> a(100'003), b(100'003, 2.0f), d(100'003, -1.0f);
+        for (std::size_t i{}; i < 100'003; ++i) a[i] = static_cast<float>(i);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_d(d);
+        static_assert(Lazy::Stream<decltype(a)>::is_streamed<decltype(lazy_a * lazy_b)> == Lazy::detail::Simd::streamed, "");
+
+        Lazy::stream(lazy_d, 0) = lazy_a * lazy_b + 1.0f;
+        assert(d[0] == 1.0f && d[77] == 155.0f && d[100'002] == 200'005.0f);
+
+        // ...element wise in place, and over a destination which is not aligned to a packet
+        Lazy::stream(lazy_d, 0) = lazy_d - lazy_a;
+        auto view = Lazy::slice(lazy_d, 3, 100'000);
+        Lazy::stream(view, 0) = Lazy::slice(lazy_b, 0, 99'997) * 3.0f;
+        assert(d[0] == 1.0f && d[2] == 3.0f && d[3] == 6.0f && d[99'999] == 6.0f && d[100'000] == 100'001.0f);
+
+        // destinations shorter than the threshold (or expressions which can not be streamed) are assigned as usual
+        std::vector<std::string> s(10, "cached");
+        Lazy::Container<decltype(s)> lazy_s(s);
+        Lazy::stream(lazy_d) = lazy_b;
+        Lazy::stream(lazy_s, 0) = lazy_s + "!";
+        assert(d[0] == 2.0f && d[100'002] == 2.0f && s[9] == "cached!");
+    }
+
+    // test incremental evaluation (only the indices modified in tracked leaves are re-evaluated)
+    {
+        std::vector<float> a(10'000, 1.0f), b(10'000, 2.0f), d(10'000);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_d(d);
+        Lazy::Tracked<decltype(a)> tracked_a(lazy_a);
+
+        auto inc = Lazy::incremental(lazy_d, tracked_a * lazy_b + 1.0f);
+        assert(d[0] == 3.0f && d[9'999] == 3.0f && inc.refresh() == 0);
+
+        // modified elements (and marked ranges) are merged into disjoint ranges
+        tracked_a.set(7, 2.0f);
+        tracked_a.set(8, 3.0f);
+        std::fill(a.begin() + 100, a.begin() + 200, 0.0f);
+        tracked_a.mark(100, 200);
+        tracked_a.mark(150, 250);
+        assert(tracked_a.dirty().ranges().size() == 2 && tracked_a.dirty().count() == 152);
+
+        // an element changed on the host without being marked is not re-evaluated
+        b[0] = 0.0f;
+        assert(inc.refresh() == 152 && tracked_a.dirty().empty());
+        assert(d[0] == 3.0f && d[7] == 5.0f && d[8] == 7.0f && d[150] == 1.0f && d[249] == 3.0f && d[250] == 3.0f);
+        assert(inc.refresh(true) == 10'000 && d[0] == 1.0f);
+
+        // tracked leaves are found under cached operands
+        auto cached = Lazy::incremental(lazy_d, Lazy::cache(tracked_a * lazy_b));
+        tracked_a.set(5, 10.0f);
+        assert(cached.refresh() == 1 && d[5] == 20.0f);
+        static_assert(Lazy::detail::Concepts::has_operands_v<std::decay_t<decltype(Lazy::cache(tracked_a * lazy_b))>> &&
+                      !Lazy::detail::Concepts::has_operands_v<Lazy::Tracked<decltype(a)>>, "");
+
+        // a tracked leaf alone, and several tracked leaves (of another element type)
+        std::vector<std::string> s(100, "x"), t(100, "y"), u(100);
+        Lazy::Container<decltype(s)> lazy_s(s),
+                                     lazy_t(t),
+                                     lazy_u(u);
+        Lazy::Tracked<decltype(s)> tracked_s(lazy_s),
+                                   tracked_t(lazy_t);
+        auto concatenation = Lazy::incremental(lazy_u, tracked_s + tracked_t);
+        tracked_s.set(3, "a");
+        tracked_t.set(99, "b");
+        assert(concatenation.refresh() == 2 && u[3] == "ay" && u[99] == "xb" && u[0] == "xy");
+        auto copy = Lazy::incremental(lazy_d, tracked_a);
+        tracked_a.set(0, 5.0f);
+        assert(copy.refresh() == 1 && d[0] == 5.0f && d[1] == 1.0f);
+    }
+
+    // test operations between different element types (promoted by the usual arithmetic conversions, and converted per packet lane)
+    {
+        std::vector<float>        f(1'003, 16'777'216.0f);
+        std::vector<double>       acc(1'003, 1.0);
+        std::vector<std::int8_t>  i8(1'003, 3);
+        std::vector<std::int32_t> i32(1'003, 100'000);
+        Lazy::Container<decltype(f)>   lazy_f(f);
+        Lazy::Container<decltype(acc)> lazy_acc(acc);
+        Lazy::Container<decltype(i8)>  lazy_i8(i8);
+        Lazy::Container<decltype(i32)> lazy_i32(i32);
+        static_assert(std::is_same_v<decltype(lazy_f + lazy_acc)::value_type, double>, "");
+        static_assert(std::is_same_v<decltype(lazy_i8 * lazy_i32)::value_type, std::int32_t>, "");
+        static_assert(std::is_same_v<decltype(lazy_f * 2.0)::value_type, float>, "");
+        static_assert(decltype(lazy_f + lazy_acc)::is_vectorizable == Lazy::detail::Simd::enabled, "");
+
+        // float storage with double accumulation (2^24 + 1 is not a float)
+        lazy_acc = lazy_f + lazy_acc;
+        assert(acc[0] == 16'777'217.0 && acc[1'002] == 16'777'217.0);
+        lazy_acc += lazy_f * lazy_acc - lazy_acc * lazy_f;
+        assert(acc[500] == 16'777'217.0);
+
+        // narrowing into the destination element type
+        lazy_f = lazy_acc * 0.5;
+        assert(f[0] == static_cast<float>(8'388'608.5) && f[1'002] == f[0]);
+
+        // integral widening (3 * 100'000 overflows an 8 bit integer)
+        lazy_i32 = lazy_i8 * lazy_i32 + lazy_i8;
+        assert(i32[0] == 300'003 && i32[1'002] == 300'003);
+
+        // conditions, chains, masks and static extents of mixed element types
+        lazy_acc = Lazy::where(lazy_f > lazy_acc, lazy_f, lazy_acc - lazy_f);
+        assert(acc[7] == 16'777'217.0 - static_cast<double>(f[7]));
+        lazy_acc = lazy_f + lazy_acc + lazy_i8 + lazy_f;
+        assert(acc[9] == 16'777'217.0 + 3.0 + static_cast<double>(f[9]));
+        lazy_acc.masked(lazy_i8 > 2) -= lazy_i32;
+        assert(acc[1'002] == 16'777'220.0 + static_cast<double>(f[1'002]) - 300'003.0);
+
+        std::array<float, 12>  sf{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+        std::array<double, 12> sd{};
+        Lazy::Container<decltype(sf)> lazy_sf(sf);
+        Lazy::Container<decltype(sd)> lazy_sd(sd);
+        lazy_sd = lazy_sf * lazy_sf + 0.5;
+        assert(sd[0] == 1.5 && sd[11] == 144.5);
+    }
+
+#if defined(MAKELAZY_INSTRUMENTATION)
+    // test instrumentation of assignments
+    {
+        std::vector<float> a(1'000, 1.0f), b(1'000, 2.0f), d(1'000);
+        Lazy::Container<decltype(a)> lazy_a(a),
+                                     lazy_b(b),
+                                     lazy_d(d);
+
+        std::vector<Lazy::Instrumentation::Record> records;
+        Lazy::Instrumentation::set_sink([&records](const Lazy::Instrumentation::Record& xi_record) { records.push_back(xi_record); });
+
+        lazy_d = lazy_a * 2.0f + lazy_b;
+        lazy_d += -lazy_a;
+        Lazy::par(lazy_d, 64) = Lazy::where(lazy_a > lazy_b, lazy_a, lazy_b);
+        assert(records.size() == 3);
+        assert(records[0].shape == "((l*s)+l)" && records[0].nodes == 5 && std::string(records[0].assignment) == "=" && std::string(records[0].engine) == "sequential");
+        assert(records[0].elements == 1'000 && records[0].bytes == 1'000 * 3 * sizeof(float) && records[0].vectorized == Lazy::detail::Simd::enabled && records[0].allocations == 0);
+        assert(records[1].shape == "-l" && std::string(records[1].assignment) == "+" && records[1].bytes == 1'000 * 3 * sizeof(float));
+        assert(records[2].shape == "where((l>l),l,l)" && std::string(records[2].engine) == "parallel");
+
+        // masked, fused, incremental and batched evaluations
+        std::vector<float> e(1'000);
+        Lazy::Container<decltype(e)> lazy_e(e);
+        Lazy::Tracked<decltype(a)> tracked_a(lazy_a);
+        lazy_d.masked(lazy_a < lazy_b) = lazy_b;
+        Lazy::assign_all(std::tie(lazy_d, lazy_e), lazy_a + lazy_b, lazy_a - lazy_b);
+        auto inc = Lazy::incremental(lazy_e, tracked_a * 2.0f);
+        tracked_a.set(3, 4.0f);
+        inc.refresh();
+        float batched{};
+        Lazy::for_each_batch(lazy_a * lazy_b, [&batched](const float* xi_batch, std::size_t xi_count) { for (std::size_t i{}; i < xi_count; ++i) batched += xi_batch[i]; });
+        assert(records.size() == 8 && batched == 2'006.0f);
+        assert(std::string(records[3].engine) == "masked" && records[3].shape == "l" && records[3].elements == 1'000);
+        assert(std::string(records[4].engine) == "fused" && records[4].shape == "(l+l);(l-l)" && records[4].nodes == 6);
+        assert(std::string(records[5].engine) == "incremental" && records[5].shape == "(l*s)" && records[5].elements == 1'000);
+        assert(std::string(records[6].engine) == "incremental" && records[6].elements == 1 && e[3] == 8.0f);
+        assert(std::string(records[7].engine) == "batched" && records[7].shape == "(l*l)" && records[7].elements == 1'000);
+
+        // allocations of heap owning elements
+        std::uint64_t allocations{};
+        Lazy::Instrumentation::set_allocation_counter([&allocations] { return allocations; });
+        std::vector<std::string> s(10, "ab"), sd(10);
+        Lazy::Container<decltype(s)> lazy_s(s),
+                                     lazy_sd(sd);
+        lazy_sd = Lazy::map([&allocations](const std::string& x) { ++allocations; return x + x; }, lazy_s);
+        assert(records.size() == 9 && records[8].shape == "map(l)" && records[8].allocations == 10 && sd[9] == "abab");
+
+        // an empty sink disables recording
+        Lazy::Instrumentation::set_sink({});
+        Lazy::Instrumentation::set_allocation_counter({});
+        lazy_d = lazy_a;
+        assert(records.size() == 9);
+    }
+#endif
+
     // test a case with container holding a complex structure
     {
         // stack based containers holding 'Elements'
@@ -86,23 +1269,64 @@ int main() {
                                        lazy_c(cvt),
                                        lazy_d(dvt);
 
-        // test lazy evaluation
-        Clock::time_point m_start;
+        // test lazy evaluation against element wise evaluation
+        std::array<Element, 100> evt(dvt);
         lazy_d += lazy_a + lazy_b + lazy_c;
-        const Clock::time_point end{ Clock::now() };
-        auto lazy_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - m_start).count();
+        for (std::size_t i{}; i < 100; ++i) {
+            evt[i] += avt[i] + bvt[i] + cvt[i];
+        }
+        for (std::size_t i{}; i < 100; ++i) {
+            assert(dvt[i].m_int == evt[i].m_int && dvt[i].m_float == evt[i].m_float && dvt[i].m_string == evt[i].m_string);
+        }
 
+        // additions are built in the destination elements, so their strings keep their buffers
+        std::vector<Element> ve(100, Element{1, 1.0f, "abcdefghij"}), vd(100);
+        for (Element& x : vd) x.m_string.reserve(64);
+        [[maybe_unused]] const char* buffer{ vd[7].m_string.data() };
+        Lazy::Container<decltype(ve)> lazy_ve(ve),
+                                      lazy_vd(vd);
+        lazy_vd = lazy_ve + lazy_ve + lazy_ve;
+        assert(vd[7].m_int == 3 && vd[7].m_string.size() == 30 && vd[7].m_string.data() == buffer);
+        lazy_vd += lazy_ve + lazy_ve;
+        assert(vd[7].m_int == 5 && vd[99].m_string.size() == 50 && vd[7].m_string.data() == buffer);
 
-        Clock::time_point m_start1;
+        // the same evaluation over structs of arrays, member by member
+        using ElementSoa = Lazy::Soa<Element, &Element::m_int, &Element::m_float, &Element::m_string>;
+        ElementSoa as(100, avt[0]),
+                   bs(100, bvt[0]),
+                   cs(100, cvt[0]),
+                   ds(100, Element{0, 0.0f, "__"});
+        Lazy::Container<ElementSoa> lazy_as(as),
+                                    lazy_bs(bs),
+                                    lazy_cs(cs),
+                                    lazy_ds(ds);
+        lazy_ds += lazy_as + lazy_bs + lazy_cs;
         for (std::size_t i{}; i < 100; ++i) {
-            dvt[i] += avt[i] + bvt[i] + cvt[i];
+            assert(ds[i].m_int == evt[i].m_int && ds[i].m_float == evt[i].m_float && ds[i].m_string == evt[i].m_string);
         }
-        const Clock::time_point end1{ Clock::now() };
-        auto scalar_time = std::chrono::duration_cast<std::chrono::milliseconds>(end1 - m_start1).count();
-        auto diff = lazy_time - scalar_time;
-        bool temp = lazy_time < scalar_time;
-        std::cout << "lazy is " << std::string(temp ? "faster" : "slower");
+
+        // aggregates are split into members, and numeric members are reduced on their own
+        lazy_ds = lazy_as + Element{1, 2.0f, "!"};
+        assert(ds[99].m_int == 326 && ds[99].m_float == -13.0f && ds[99].m_string == "hi!" && (lazy_as + lazy_bs)[5].m_string == "hi expression ");
+        assert(Lazy::sum(Lazy::member<0>(lazy_as + lazy_bs)) == 0 && Lazy::sum(Lazy::member<1>(lazy_cs)) == 100.0f);
+        lazy_ds = lazy_cs;
+        assert(ds[0].m_string == "template" && ds.array<1>()[42] == 1.0f);
+    }
+
+    // test numeric structs of arrays (every member is evaluated in packets)
+    {
+        struct Point { float x{}; float y{}; double w{}; };
+        using Points = Lazy::Soa<Point, &Point::x, &Point::y, &Point::w>;
+        Points p(1'003, Point{1.0f, 2.0f, 4.0}),
+               q(1'003, Point{3.0f, 5.0f, 0.5});
+        q.set(1'002, Point{-1.0f, -1.0f, -1.0});
+        Lazy::Container<Points> lazy_p(p),
+                                lazy_q(q);
+        lazy_p = (lazy_p + lazy_q) * 2.0f - lazy_p / lazy_q;
+        assert(p[0].x == 8.0f - 1.0f / 3.0f && p[0].y == 14.0f - 0.4f && p[0].w == 9.0 - 8.0);
+        assert(p[1'002].x == 1.0f && p[1'002].y == 4.0f && p[1'002].w == 10.0);
     }
     
-    return 1;
+    std::cout << "all tests passed\n";
+    return 0;
 }